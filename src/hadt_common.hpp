@@ -5,6 +5,40 @@
  *	 -- helper functions
  */
 
+// std::uint32_t, std::uint8_t
+#include <cstdint>
+
+// std::aligned_storage
+#include <type_traits>
+
+// std::vector
+#include <vector>
+
+// std::move
+#include <utility>
+
+// std::fill
+#include <algorithm>
+
+// _mm_prefetch
+#if defined(_MSC_VER) && !defined(HADT_NO_PREFETCH)
+#include <xmmintrin.h>
+#endif
+
+// _BitScanForward64
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+// Translation units built with different HADT_NO_PREFETCH settings fail to link (LNK2038)
+#if defined(_MSC_VER)
+#if defined(HADT_NO_PREFETCH)
+#pragma detect_mismatch("HADT_NO_PREFETCH", "1")
+#else
+#pragma detect_mismatch("HADT_NO_PREFETCH", "0")
+#endif
+#endif
+
 namespace hadt {
 
 	template <class T, class W>
@@ -13,6 +47,78 @@ namespace hadt {
 		return std::make_tuple(a1, a2, a3);
 	};
 
+	// Software prefetch hint for a node that is about to be visited. Only worth it when the
+	// address is known well ahead of the use (e.g. vertices queued by a traversal): in a plain
+	// pointer chase the next node is needed right away. Define HADT_NO_PREFETCH to compile all
+	// hints out. It is a project-wide setting (HadtNoPrefetch build property): every container
+	// template calling prefetch changes with it, so all translation units must agree on it
+	inline auto prefetch(const void* ptr) -> void
+	{
+#if defined(HADT_NO_PREFETCH)
+		(void)ptr;
+#elif defined(_MSC_VER)
+		_mm_prefetch(static_cast<const char*>(ptr), _MM_HINT_T0);
+#else
+		__builtin_prefetch(ptr);
+#endif
+	}
+
+	// Index of the lowest set bit of a non-zero word
+	inline auto lowest_bit(std::uint64_t word) -> unsigned
+	{
+#if defined(_MSC_VER)
+		unsigned long index;
+		_BitScanForward64(&index, word);
+		return static_cast<unsigned>(index);
+#else
+		return static_cast<unsigned>(__builtin_ctzll(word));
+#endif
+	}
+
+	/* Reusable visited state of a graph traversal, indexed by dense vertex id.
+	 * A vertex counts as visited only if its stamp equals the current epoch,
+	 * so starting a new traversal doesn't need a reset pass.
+	 */
+	class visited_marks
+	{
+	private:
+
+		std::vector<std::uint32_t> stamps;
+		std::uint32_t epoch;
+
+	public:
+
+		visited_marks() : epoch{ 0 } {};
+
+		// O(1) amortized | starts a new traversal over ids [0, id_bound)
+		auto reset(size_t id_bound) -> void
+		{
+			if (stamps.size() < id_bound)
+				stamps.resize(id_bound, 0);
+
+			// Stamps left by older traversals would match again after a wrap-around
+			if (++epoch == 0)
+			{
+				std::fill(stamps.begin(), stamps.end(), 0);
+				epoch = 1;
+			}
+		}
+
+		inline auto is_marked(size_t id) const -> bool { return stamps[id] == epoch; };
+		inline auto mark(size_t id) -> void { stamps[id] = epoch; };
+		inline auto unmark(size_t id) -> void { stamps[id] = 0; };
+
+		// Marks <id>; returns false if it was already marked
+		inline auto test_and_mark(size_t id) -> bool
+		{
+			if (stamps[id] == epoch)
+				return false;
+
+			stamps[id] = epoch;
+			return true;
+		};
+	};
+
 	namespace nodes {
 
 		template <class T, class W>
@@ -41,6 +147,42 @@ namespace hadt {
 			HNode& operator=(HNode&& node) = delete;
 		};
 
+		/* External class: Index-linked Node Data */
+		template <class T>
+		class CNode
+		{
+		public:
+			T data;
+
+			// Positions of neighbours in the node pool
+			std::uint32_t next;
+			std::uint32_t prev;
+
+			explicit CNode(T d) : next{ 0 }, prev{ 0 } { data = std::move(d); };
+		};
+
+		/* External class: Type-tagged Node Data (raw storage fits any type of a hetero_list) */
+		template <size_t Size, size_t Align>
+		class HeteroNode
+		{
+		public:
+			typename std::aligned_storage<Size, Align>::type storage;
+
+			HeteroNode *next;
+			HeteroNode *prev;
+
+			// Index of the stored type in hetero_list's type pack
+			std::uint8_t tag;
+
+			explicit HeteroNode(std::uint8_t t) : next{ nullptr }, prev{ nullptr }, tag{ t } {};
+
+			// copy ctor; move ctor; copy assign; move assign
+			HeteroNode(const HeteroNode& node) = delete;
+			HeteroNode& operator=(const HeteroNode& node) = delete;
+			HeteroNode(HeteroNode&& node) = delete;
+			HeteroNode& operator=(HeteroNode&& node) = delete;
+		};
+
 		/* External class : Vertex Data */
 		template <class T, class W>
 		class VertexNode
@@ -48,16 +190,25 @@ namespace hadt {
 		public:
 			T data;
 			bool is_visited;
+			// Dense id (unique among live vertices of the graph, reused after removal)
+			std::uint32_t id;
 			VertexNode *next;
+			// Previous vertex (nullptr for the first one)
+			VertexNode *prev;
 			EdgeNode<T, W> *edge_head;
+			// Last edge (nullptr if there are no edges) and out-degree
+			EdgeNode<T, W> *edge_tail;
+			size_t edge_count;
+			// Graph the vertex belongs to (nullptr for sentinels)
+			const void* owner;
 
 			explicit VertexNode(T d)
-				: is_visited{ false }, next{ nullptr }, edge_head{ nullptr }
+				: is_visited{ false }, id{ 0 }, next{ nullptr }, prev{ nullptr }, edge_head{ nullptr }, edge_tail{ nullptr }, edge_count{ 0 }, owner{ nullptr }
 			{
 				data = d;
 			};
 			VertexNode(T d, bool vis, VertexNode* vn, EdgeNode<T, W>* en)
-				: is_visited{ vis }, next{ vn }, edge_head{ en } {
+				: is_visited{ vis }, id{ 0 }, next{ vn }, prev{ nullptr }, edge_head{ en }, edge_tail{ nullptr }, edge_count{ 0 }, owner{ nullptr } {
 				data = d;
 			};
 		};
@@ -70,11 +221,26 @@ namespace hadt {
 			W weight;
 			VertexNode<T, W>* connects_to;
 			EdgeNode* next;
+			// Previous edge of the same vertex (nullptr for the first one)
+			EdgeNode* prev;
+			// Position in the incoming edge list of <connects_to> (valid only if graph tracks in-edges)
+			size_t in_slot;
 
 			explicit EdgeNode(W w)
-				: weight{ w }, connects_to{ nullptr }, next{ nullptr } {};
+				: weight{ w }, connects_to{ nullptr }, next{ nullptr }, prev{ nullptr }, in_slot{ 0 } {};
 			EdgeNode(W w, VertexNode<T, W>* vn, EdgeNode* en)
-				: weight{ w }, connects_to{ vn }, next{ en } {};
+				: weight{ w }, connects_to{ vn }, next{ en }, prev{ nullptr }, in_slot{ 0 } {};
+		};
+
+		/* External class : Edges of a vertex kept as two parallel arrays (graph's edge arrays mode).
+		 * The graph holds them aside, by vertex id; they come after the vertex' chain of edges
+		 */
+		template <class T, class W>
+		class EdgeArrays
+		{
+		public:
+			std::vector<VertexNode<T, W>*> targets;
+			std::vector<W> weights;
 		};
 
 	}
@@ -147,12 +313,21 @@ namespace hadt {
 	template <class T>
 	using HNode = nodes::HNode<T>;
 
+	template <class T>
+	using CNode = nodes::CNode<T>;
+
+	template <size_t Size, size_t Align>
+	using HeteroNode = nodes::HeteroNode<Size, Align>;
+
 	template <class T, class W>
 	using VertexNode = nodes::VertexNode<T, W>;
 
 	template <class T, class W>
 	using EdgeNode = nodes::EdgeNode<T, W>;
 
+	template <class T, class W>
+	using EdgeArrays = nodes::EdgeArrays<T, W>;
+
 	template <class T, bool is_const>
 	using node_iterator_base = iterators::node_iterator_base<T, is_const>;
 
@@ -0,0 +1,540 @@
+#pragma once
+
+// std::bidirectional_iterator_tag, std::iterator
+#include <iterator>
+
+// std::out_of_range, std::length_error
+#include <stdexcept>
+
+// std::cout, std::endl, std::ostream
+#include <iostream>
+
+// std::move, std::swap, std::ptrdiff_t
+#include <utility>
+
+// std::is_same, std::enable_if, std::conditional
+#include <type_traits>
+
+// std::initializer_list
+#include <initializer_list>
+
+// std::vector
+#include <vector>
+
+// std::uint32_t
+#include <cstdint>
+
+#include "hadt_common.hpp"
+
+namespace hadt {
+
+	/* Doubly-linked list whose nodes live in one growable pool and are linked
+	 * by 32-bit indices instead of pointers:
+	 *   -- slot 0 of the pool is the sentinel (circular list: begin() is its <next>, rbegin() its <prev>)
+	 *   -- removed slots are reused through a free list threaded over <next>
+	 *   -- nodes are relocatable, so the pool grows (or gets copied out) with plain memcpy-like moves
+	 */
+	template <class T>
+	class compact_list
+	{
+	public:
+
+		typedef std::uint32_t index_type;
+
+	protected:
+
+		typedef std::vector<CNode<T>> pool_type;
+
+		/* Internal class : [Const] [Reverse] Iterator */
+
+		template <bool IsConst = false, bool IsReverse = false>
+		class list_iterator : public std::iterator <std::bidirectional_iterator_tag, T>
+		{
+			// pool_type * / const pool_type *
+			typedef typename std::conditional<IsConst, const pool_type*, pool_type*>::type pool_pointer;
+
+		public:
+
+			typedef T value_type;
+			// T& / const T&
+			typedef typename hadt::node_iterator_base<T, IsConst>::iterator_reference reference;
+			// T* / const T*
+			typedef typename hadt::node_iterator_base<T, IsConst>::iterator_pointer pointer;
+			typedef std::ptrdiff_t difference_type;
+			typedef std::bidirectional_iterator_tag iterator_category;
+
+			list_iterator() : pool_{ nullptr }, idx_{ 0 } {};
+			list_iterator(pool_pointer pool, index_type idx) : pool_(pool), idx_(idx) {};
+
+			list_iterator(const list_iterator<IsConst, IsReverse>& it) : pool_(it.pool_), idx_(it.idx_) {};
+			list_iterator(const list_iterator<IsConst, IsReverse>&& it) : pool_(it.pool_), idx_(it.idx_) {};
+
+			list_iterator<IsConst, IsReverse>& operator=(const list_iterator<IsConst, IsReverse>& it) = delete;
+			list_iterator<IsConst, IsReverse>& operator=(const list_iterator<IsConst, IsReverse>&& it) = delete;
+
+			bool operator==(const list_iterator<IsConst, IsReverse>& other) const { return idx_ == other.idx_ && pool_ == other.pool_; }
+			bool operator!=(const list_iterator<IsConst, IsReverse>& other) const { return !(*this == other); }
+
+			reference operator*() const { return (*pool_)[idx_].data; }
+			pointer operator->() const { return &((*pool_)[idx_].data); }
+
+			auto get_index() const -> index_type { return idx_; }
+
+			auto operator++() -> list_iterator<IsConst, IsReverse>&
+			{
+				idx_ = IsReverse ? (*pool_)[idx_].prev : (*pool_)[idx_].next;
+				return *this;
+			}
+
+			auto operator++(int) -> list_iterator<IsConst, IsReverse>
+			{
+				list_iterator<IsConst, IsReverse> it(*this);
+				this->operator++();
+				return it;
+			}
+
+			auto operator--() -> list_iterator<IsConst, IsReverse>&
+			{
+				idx_ = IsReverse ? (*pool_)[idx_].next : (*pool_)[idx_].prev;
+				return *this;
+			}
+
+			auto operator--(int) -> list_iterator<IsConst, IsReverse>
+			{
+				list_iterator<IsConst, IsReverse> it(*this);
+				this->operator--();
+				return it;
+			}
+
+		private:
+
+			pool_pointer pool_;
+			index_type idx_;
+		};
+
+		// Slot 0 is the sentinel
+		pool_type pool;
+		// Head of the free slots list (0 means "no free slots")
+		index_type free_head;
+
+		size_t size_;
+
+	public:
+
+		typedef std::bidirectional_iterator_tag iterator_category;
+
+		typedef list_iterator<false, false> iterator;
+		typedef list_iterator<true, false> const_iterator;
+		typedef list_iterator<false, true> reverse_iterator;
+		typedef list_iterator<true, true> const_reverse_iterator;
+
+		compact_list();
+		~compact_list() throw() {};
+
+		// copy ctor; move ctor; copy assign; move assign
+		compact_list(const compact_list& node) = delete;
+		compact_list& operator=(const compact_list& node) = delete;
+		compact_list(compact_list&& node) = delete;
+		compact_list& operator=(compact_list&& node) = delete;
+
+		iterator begin() { return iterator(&pool, pool[0].next); }
+		iterator end() { return iterator(&pool, 0); }
+
+		const_iterator cbegin() const { return const_iterator(&pool, pool[0].next); }
+		const_iterator cend() const { return const_iterator(&pool, 0); }
+
+		reverse_iterator rbegin() { return reverse_iterator(&pool, pool[0].prev); }
+		reverse_iterator rend() { return reverse_iterator(&pool, 0); }
+
+		const_reverse_iterator rcbegin() const { return const_reverse_iterator(&pool, pool[0].prev); }
+		const_reverse_iterator rcend() const { return const_reverse_iterator(&pool, 0); }
+
+		// Insert at front
+		auto push_front(const T& data) throw(std::length_error) -> void;
+		auto move_front(T&& data) throw(std::length_error) -> void;
+
+		// Insert at back
+		auto push_back(const T& data) throw(std::length_error) -> void;
+		auto move_back(T&& data) throw(std::length_error) -> void;
+
+		// Pop(remove) from the list
+		auto pop_front() throw(std::length_error, std::out_of_range)->T;
+		auto pop_back() throw(std::length_error, std::out_of_range)->T;
+		auto pop_at(size_t idx) throw(std::length_error, std::out_of_range)->T;
+
+		// Populate the list
+		auto fill_with(std::initializer_list<T> init_list) -> void;
+
+		template <class Iter, class Enable = typename std::enable_if<
+			(std::is_same<typename std::iterator_traits<Iter>::iterator_category, std::forward_iterator_tag>::value ||
+			std::is_same<typename std::iterator_traits<Iter>::iterator_category, std::bidirectional_iterator_tag>::value ||
+			std::is_same<typename std::iterator_traits<Iter>::iterator_category, std::random_access_iterator_tag>::value) &&
+			std::is_same<typename std::iterator_traits<Iter>::value_type, T>::value
+		>::type>
+		auto fill_with(const Iter& _begin, const Iter& _end) -> void;
+
+		// Append / Prepend the list
+		auto append_with(std::initializer_list<T> append_list) -> void;
+		auto prepend_with(std::initializer_list<T> prepend_list) -> void;
+
+		template <class Iter, class Enable = typename std::enable_if<
+			(std::is_same<typename std::iterator_traits<Iter>::iterator_category, std::forward_iterator_tag>::value ||
+			std::is_same<typename std::iterator_traits<Iter>::iterator_category, std::bidirectional_iterator_tag>::value ||
+			std::is_same<typename std::iterator_traits<Iter>::iterator_category, std::random_access_iterator_tag>::value) &&
+			std::is_same<typename std::iterator_traits<Iter>::value_type, T>::value
+		>::type>
+		auto append_with(const Iter& _begin, const Iter& _end) -> void;
+
+		template <class Iter, class Enable = typename std::enable_if<
+			(std::is_same<typename std::iterator_traits<Iter>::iterator_category, std::forward_iterator_tag>::value ||
+			std::is_same<typename std::iterator_traits<Iter>::iterator_category, std::bidirectional_iterator_tag>::value ||
+			std::is_same<typename std::iterator_traits<Iter>::iterator_category, std::random_access_iterator_tag>::value) &&
+			std::is_same<typename std::iterator_traits<Iter>::value_type, T>::value
+		>::type>
+		auto prepend_with(const Iter& _begin, const Iter& _end) -> void;
+
+		// Find by value/by index
+		// O(n)
+		auto find_first(T value) -> iterator;
+		// O(idx)
+		auto find_nth_to_last(size_t idx) throw(std::out_of_range) -> iterator;
+
+		// Look at item in idx position
+		// O(min(idx, size() - idx))
+		auto at(size_t idx) throw(std::out_of_range) -> T;
+		auto at_front() throw(std::out_of_range) -> T;
+		auto at_back() throw(std::out_of_range) -> T;
+
+		// Reverse the list
+		// O(n) | swaps links only, data stays in place
+		auto reverse_inplace() -> void;
+		auto reverse(compact_list<T>& ref) -> void;
+
+		// Service functions
+		inline auto size() const -> size_t { return size_; };
+		inline auto empty() const -> bool { return size_ == 0; };
+
+		// Pool management
+		// O(1) | returns count of node slots (sentinel excluded) available without growing the pool
+		inline auto capacity() const -> size_t { return pool.capacity() - 1; };
+		auto reserve(size_t count) throw(std::length_error) -> void;
+
+		// Print list
+		auto print(std::ostream& ostream = std::cout) const -> std::ostream&;
+		auto print_reverse(std::ostream& ostream = std::cout) const -> std::ostream&;
+
+		// Clear container (pool memory is kept for reuse)
+		auto clear() throw() -> void;
+
+	private:
+
+		// Take a slot from the free list (or grow the pool) and link it after <pos>
+		auto _insert_after(index_type pos, T&& data) throw(std::length_error) -> void;
+
+		// Unlink slot and put it onto the free list
+		auto _remove(index_type idx) -> T;
+
+		// Return slot index at given position
+		auto _index_at(size_t idx) const throw(std::out_of_range) -> index_type;
+	};
+
+	template <class T>
+	compact_list<T>::compact_list() :
+		free_head{ 0 },
+		size_{ 0 }
+	{
+		// Sentinel
+		pool.emplace_back(T{});
+	}
+
+	template <class T>
+	auto compact_list<T>::_insert_after(index_type pos, T&& data) throw(std::length_error) -> void
+	{
+		index_type idx = free_head;
+
+		if (0 != idx)
+		{
+			free_head = pool[idx].next;
+			pool[idx].data = std::move(data);
+		}
+		else
+		{
+			// Every slot must stay addressable by a 32-bit index
+			if (pool.size() >= static_cast<size_t>(UINT32_MAX))
+				throw std::length_error("compact_list is full");
+
+			idx = static_cast<index_type>(pool.size());
+			pool.emplace_back(std::move(data));
+		}
+
+		index_type succ = pool[pos].next;
+
+		pool[idx].prev = pos;
+		pool[idx].next = succ;
+		pool[succ].prev = idx;
+		pool[pos].next = idx;
+
+		size_++;
+	}
+
+	template <class T>
+	auto compact_list<T>::_remove(index_type idx) -> T
+	{
+		T val = std::move(pool[idx].data);
+
+		pool[pool[idx].prev].next = pool[idx].next;
+		pool[pool[idx].next].prev = pool[idx].prev;
+
+		// Release resources held by the slot and put it onto the free list
+		pool[idx].data = T{};
+		pool[idx].prev = 0;
+		pool[idx].next = free_head;
+		free_head = idx;
+
+		size_--;
+
+		return val;
+	}
+
+	template <class T>
+	auto compact_list<T>::_index_at(size_t idx) const throw(std::out_of_range) -> index_type
+	{
+		if (idx >= size())
+			throw std::out_of_range("_index_at()");
+
+		index_type curr{};
+
+		// Walk from the closest end
+		if (idx < size() / 2)
+		{
+			curr = pool[0].next;
+			while (idx-- > 0)
+				curr = pool[curr].next;
+		}
+		else
+		{
+			curr = pool[0].prev;
+			idx = size() - 1 - idx;
+			while (idx-- > 0)
+				curr = pool[curr].prev;
+		}
+
+		return curr;
+	}
+
+	template <class T>
+	auto compact_list<T>::push_front(const T& data) throw(std::length_error) -> void
+	{
+		_insert_after(0, std::move(T{ data }));
+	}
+
+	template <class T>
+	auto compact_list<T>::move_front(T&& data) throw(std::length_error) -> void
+	{
+		_insert_after(0, std::move(data));
+	}
+
+	template <class T>
+	auto compact_list<T>::push_back(const T& data) throw(std::length_error) -> void
+	{
+		_insert_after(pool[0].prev, std::move(T{ data }));
+	}
+
+	template <class T>
+	auto compact_list<T>::move_back(T&& data) throw(std::length_error) -> void
+	{
+		_insert_after(pool[0].prev, std::move(data));
+	}
+
+	template <class T>
+	auto compact_list<T>::pop_front() throw(std::length_error, std::out_of_range) -> T
+	{
+		if (empty())
+			throw std::length_error("list is empty");
+
+		return _remove(pool[0].next);
+	}
+
+	template <class T>
+	auto compact_list<T>::pop_back() throw(std::length_error, std::out_of_range) -> T
+	{
+		if (empty())
+			throw std::length_error("list is empty");
+
+		return _remove(pool[0].prev);
+	}
+
+	template <class T>
+	auto compact_list<T>::pop_at(size_t idx) throw(std::length_error, std::out_of_range) -> T
+	{
+		if (empty())
+			throw std::length_error("list is empty");
+
+		return _remove(_index_at(idx));
+	}
+
+	template <class T>
+	auto compact_list<T>::fill_with(std::initializer_list<T> init_list) -> void
+	{
+		clear();
+
+		append_with(init_list);
+	}
+
+	template <class T>
+	auto compact_list<T>::append_with(std::initializer_list<T> append_list) -> void
+	{
+		for (auto &x : append_list)
+			push_back(x);
+	}
+
+	template <class T>
+	auto compact_list<T>::prepend_with(std::initializer_list<T> prepend_list) -> void
+	{
+		for (auto &x : prepend_list)
+			push_front(x);
+	}
+
+	template <class T>
+	template <class Iter, class Enable>
+	auto compact_list<T>::fill_with(const Iter& _begin, const Iter& _end) -> void
+	{
+		clear();
+
+		append_with(_begin, _end);
+	}
+
+	template <class T>
+	template <class Iter, class Enable>
+	auto compact_list<T>::append_with(const Iter& _begin, const Iter& _end) -> void
+	{
+		auto it = _begin;
+		while (it != _end)
+			push_back(*it++);
+	}
+
+	template <class T>
+	template <class Iter, class Enable>
+	auto compact_list<T>::prepend_with(const Iter& _begin, const Iter& _end) -> void
+	{
+		auto it = _begin;
+		while (it != _end)
+			push_front(*it++);
+	}
+
+	template <class T>
+	auto compact_list<T>::find_first(T value) -> iterator
+	{
+		index_type curr = pool[0].next;
+
+		while (curr != 0 && pool[curr].data != value)
+			curr = pool[curr].next;
+
+		return iterator(&pool, curr);
+	}
+
+	template <class T>
+	auto compact_list<T>::find_nth_to_last(size_t idx) throw(std::out_of_range) -> iterator
+	{
+		if (idx >= size())
+			throw std::out_of_range("find_nth_to_last()");
+
+		return iterator(&pool, _index_at(size() - 1 - idx));
+	}
+
+	template <class T>
+	auto compact_list<T>::at(size_t idx) throw(std::out_of_range) -> T
+	{
+		if (idx >= size())
+			throw std::out_of_range("at()");
+
+		return pool[_index_at(idx)].data;
+	}
+
+	template <class T>
+	auto compact_list<T>::at_front() throw(std::out_of_range) -> T
+	{
+		return at(0);
+	}
+
+	template <class T>
+	auto compact_list<T>::at_back() throw(std::out_of_range) -> T
+	{
+		return at(size() - 1);
+	}
+
+	template <class T>
+	auto compact_list<T>::reverse_inplace() -> void
+	{
+		if (empty()) return;
+
+		// Sentinel included: its <next>/<prev> become the new head/tail
+		index_type curr = 0;
+		do
+		{
+			std::swap(pool[curr].next, pool[curr].prev);
+			curr = pool[curr].prev;
+		} while (curr != 0);
+	}
+
+	template <class T>
+	auto compact_list<T>::reverse(compact_list<T>& ref) -> void
+	{
+		ref.clear();
+
+		if (empty()) return;
+
+		ref.reserve(size());
+
+		for (auto it = rcbegin(); it != rcend(); it++)
+			ref.push_back(*it);
+	}
+
+	template <class T>
+	auto compact_list<T>::reserve(size_t count) throw(std::length_error) -> void
+	{
+		if (count >= static_cast<size_t>(UINT32_MAX))
+			throw std::length_error("compact_list can't hold that many nodes");
+
+		pool.reserve(count + 1);
+	}
+
+	template <class T>
+	auto compact_list<T>::print(std::ostream& ostream) const -> std::ostream&
+	{
+		if (size() == 0) return ostream;
+
+		auto it = cbegin();
+
+		ostream << *it++;
+		while (it != cend())
+			ostream << "," << *it++;
+
+		return ostream;
+	}
+
+	template <class T>
+	auto compact_list<T>::print_reverse(std::ostream& ostream) const -> std::ostream&
+	{
+		if (size() == 0) return ostream;
+
+		auto it = rcbegin();
+
+		ostream << *it++;
+		while (it != rcend())
+			ostream << "," << *it++;
+
+		return ostream;
+	}
+
+	template <class T>
+	auto compact_list<T>::clear() throw() -> void
+	{
+		// Keep the sentinel only
+		pool.erase(pool.begin() + 1, pool.end());
+		pool[0].next = pool[0].prev = 0;
+
+		free_head = 0;
+		size_ = 0;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,187 @@
+#pragma once
+
+// std::out_of_range, std::length_error
+#include <stdexcept>
+
+// std::vector
+#include <vector>
+
+// std::uint32_t
+#include <cstdint>
+
+namespace hadt {
+
+	/* Indexed d-ary min-heap over keys [0, key_bound) (e.g. dense vertex ids).
+	 * Every key is in the heap at most once, so its priority can be decreased in place;
+	 * a wider node (D = 4 by default) makes the heap shallower and sift-downs more cache-friendly.
+	 */
+	template <class Prio, size_t D = 4>
+	class dary_heap
+	{
+	public:
+
+		typedef std::uint32_t index_type;
+
+		// Means "key is not in the heap"
+		static const size_t npos = static_cast<size_t>(-1);
+
+	private:
+
+		std::vector<index_type> keys;
+		std::vector<Prio> prios;
+		std::vector<size_t> pos;
+
+	public:
+
+		explicit dary_heap(size_t key_bound) : pos(key_bound, npos) {};
+
+		// copy ctor; copy assign
+		dary_heap(const dary_heap& heap) = delete;
+		dary_heap& operator=(const dary_heap& heap) = delete;
+
+		inline auto empty() const -> bool { return keys.empty(); };
+		inline auto size() const -> size_t { return keys.size(); };
+		inline auto contains(index_type key) const -> bool { return key < pos.size() && pos[key] != npos; };
+
+		// O(1) | key with the smallest priority and its priority
+		auto top() const throw(std::length_error) -> index_type;
+		auto top_priority() const throw(std::length_error) -> const Prio&;
+
+		// O(log n) | inserts <key> or lowers its priority; returns false if it already had a lower one
+		auto push_or_decrease(index_type key, const Prio& prio) throw(std::out_of_range) -> bool;
+		// O(D * log n) | removes and returns the key with the smallest priority
+		auto pop() throw(std::length_error) -> index_type;
+
+	private:
+
+		auto _place(size_t at, index_type key, const Prio& prio) -> void;
+		auto _sift_up(size_t at) -> void;
+		auto _sift_down(size_t at) -> void;
+	};
+
+	template <class Prio, size_t D>
+	const size_t dary_heap<Prio, D>::npos;
+
+	template <class Prio, size_t D>
+	auto dary_heap<Prio, D>::top() const throw(std::length_error) -> index_type
+	{
+		if (empty())
+			throw std::length_error("Heap is empty");
+
+		return keys[0];
+	}
+
+	template <class Prio, size_t D>
+	auto dary_heap<Prio, D>::top_priority() const throw(std::length_error) -> const Prio&
+	{
+		if (empty())
+			throw std::length_error("Heap is empty");
+
+		return prios[0];
+	}
+
+	template <class Prio, size_t D>
+	auto dary_heap<Prio, D>::push_or_decrease(index_type key, const Prio& prio) throw(std::out_of_range) -> bool
+	{
+		if (key >= pos.size())
+			throw std::out_of_range("Key is out of range");
+
+		if (pos[key] == npos)
+		{
+			keys.push_back(key);
+			prios.push_back(prio);
+			pos[key] = keys.size() - 1;
+		}
+		else if (prio < prios[pos[key]])
+			prios[pos[key]] = prio;
+		else
+			return false;
+
+		_sift_up(pos[key]);
+
+		return true;
+	}
+
+	template <class Prio, size_t D>
+	auto dary_heap<Prio, D>::pop() throw(std::length_error) -> index_type
+	{
+		if (empty())
+			throw std::length_error("Heap is empty");
+
+		auto key = keys[0];
+		pos[key] = npos;
+
+		// Last entry takes the root's place and sinks
+		if (keys.size() > 1)
+		{
+			_place(0, keys.back(), prios.back());
+			keys.pop_back();
+			prios.pop_back();
+			_sift_down(0);
+		}
+		else
+		{
+			keys.pop_back();
+			prios.pop_back();
+		}
+
+		return key;
+	}
+
+	template <class Prio, size_t D>
+	auto dary_heap<Prio, D>::_place(size_t at, index_type key, const Prio& prio) -> void
+	{
+		keys[at] = key;
+		prios[at] = prio;
+		pos[key] = at;
+	}
+
+	template <class Prio, size_t D>
+	auto dary_heap<Prio, D>::_sift_up(size_t at) -> void
+	{
+		auto key = keys[at];
+		auto prio = prios[at];
+
+		// Move parents down until the hole reaches the right place
+		while (at > 0)
+		{
+			auto parent = (at - 1) / D;
+			if (!(prio < prios[parent]))
+				break;
+
+			_place(at, keys[parent], prios[parent]);
+			at = parent;
+		}
+
+		_place(at, key, prio);
+	}
+
+	template <class Prio, size_t D>
+	auto dary_heap<Prio, D>::_sift_down(size_t at) -> void
+	{
+		auto key = keys[at];
+		auto prio = prios[at];
+
+		for (;;)
+		{
+			auto first = at * D + 1;
+			if (first >= keys.size())
+				break;
+
+			// Smallest of up to D children
+			auto best = first;
+			auto last = first + D < keys.size() ? first + D : keys.size();
+			for (auto child = first + 1; child < last; child++)
+				if (prios[child] < prios[best])
+					best = child;
+
+			if (!(prios[best] < prio))
+				break;
+
+			_place(at, keys[best], prios[best]);
+			at = best;
+		}
+
+		_place(at, key, prio);
+	}
+}
\ No newline at end of file
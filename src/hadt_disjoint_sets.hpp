@@ -0,0 +1,86 @@
+#pragma once
+
+// std::out_of_range
+#include <stdexcept>
+
+// std::vector
+#include <vector>
+
+// std::uint32_t
+#include <cstdint>
+
+// std::swap
+#include <utility>
+
+namespace hadt {
+
+	/* Union-find over keys [0, key_bound) (e.g. dense vertex ids).
+	 * Union by size keeps trees shallow and find() halves the path it walks,
+	 * so any sequence of operations is almost linear.
+	 */
+	class disjoint_sets
+	{
+	public:
+
+		typedef std::uint32_t index_type;
+
+	private:
+
+		std::vector<index_type> parent;
+		std::vector<index_type> set_size;
+		size_t count;
+
+	public:
+
+		explicit disjoint_sets(size_t key_bound) : parent(key_bound), set_size(key_bound, 1), count{ key_bound }
+		{
+			for (size_t key = 0; key < key_bound; key++)
+				parent[key] = static_cast<index_type>(key);
+		};
+
+		// copy ctor; copy assign
+		disjoint_sets(const disjoint_sets& sets) = delete;
+		disjoint_sets& operator=(const disjoint_sets& sets) = delete;
+
+		// O(1) | number of disjoint sets
+		inline auto size() const -> size_t { return count; };
+
+		// O(a(n)) amortized | representative of <key>'s set
+		auto find(index_type key) throw(std::out_of_range) -> index_type
+		{
+			if (key >= parent.size())
+				throw std::out_of_range("Key is out of range");
+
+			// Path halving: every other node on the way skips to its grandparent
+			while (parent[key] != key)
+			{
+				parent[key] = parent[parent[key]];
+				key = parent[key];
+			}
+
+			return key;
+		}
+
+		// O(a(n)) amortized | merges two sets; returns false if they were already one
+		auto unite(index_type a, index_type b) throw(std::out_of_range) -> bool
+		{
+			a = find(a);
+			b = find(b);
+
+			if (a == b)
+				return false;
+
+			// Smaller tree goes under the bigger one
+			if (set_size[a] < set_size[b])
+				std::swap(a, b);
+
+			parent[b] = a;
+			set_size[a] += set_size[b];
+			count--;
+
+			return true;
+		}
+
+		inline auto same(index_type a, index_type b) throw(std::out_of_range) -> bool { return find(a) == find(b); };
+	};
+}
\ No newline at end of file
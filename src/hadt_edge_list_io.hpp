@@ -0,0 +1,274 @@
+#pragma once
+/* Contains helpers for streaming edge-list dumps (see graph_list::load_edge_list):
+ *   -- chunked file reader
+ *   -- hand-rolled field parsers for text dumps
+ *   -- header of the packed binary format
+ */
+
+// std::runtime_error
+#include <stdexcept>
+
+// std::ifstream, std::ofstream
+#include <fstream>
+
+// std::string
+#include <string>
+
+// std::vector
+#include <vector>
+
+// std::min
+#include <algorithm>
+
+// std::memcpy, std::memcmp, std::memchr
+#include <cstring>
+
+// std::strtod
+#include <cstdlib>
+
+// std::uint32_t, std::uint64_t, std::uintmax_t
+#include <cstdint>
+
+// std::numeric_limits
+#include <limits>
+
+// std::is_integral, std::is_floating_point, std::is_signed, std::integral_constant
+#include <type_traits>
+
+namespace hadt {
+
+	namespace io {
+
+		/* Packed binary edge list (native byte order):
+		 *   header | vertex_count x T | edge_count x (uint32 from, uint32 to, W weight)
+		 * Edges refer to vertices by their position in the vertex section.
+		 */
+		struct edge_list_header
+		{
+			char magic[8];
+			std::uint64_t vertex_count;
+			std::uint64_t edge_count;
+			std::uint32_t payload_size;
+			std::uint32_t weight_size;
+		};
+
+		static const char edge_list_magic[8] = { 'H', 'A', 'D', 'T', 'E', 'L', '0', '1' };
+
+		/* Reads a file in large chunks; lines are returned as [first, last) ranges into the chunk */
+		class chunk_reader
+		{
+		private:
+
+			std::ifstream stream;
+			std::vector<char> buffer;
+			size_t pos;
+			size_t len;
+
+			// Moves the unread tail to the front and appends the next chunk; false if nothing was added
+			auto _refill() -> bool
+			{
+				if (!stream)
+					return false;
+
+				if (pos > 0)
+				{
+					std::memmove(buffer.data(), buffer.data() + pos, len - pos);
+					len -= pos;
+					pos = 0;
+				}
+
+				// A line that doesn't fit into the buffer
+				if (len == buffer.size())
+					buffer.resize(buffer.size() * 2);
+
+				stream.read(buffer.data() + len, static_cast<std::streamsize>(buffer.size() - len));
+				auto got = static_cast<size_t>(stream.gcount());
+				len += got;
+
+				return got > 0;
+			}
+
+		public:
+
+			explicit chunk_reader(const std::string& path, size_t chunk_size = size_t{ 1 } << 20) throw(std::runtime_error)
+				: stream(path, std::ios::in | std::ios::binary), buffer(chunk_size), pos{ 0 }, len{ 0 }
+			{
+				if (!stream.is_open())
+					throw std::runtime_error("Can't open file: " + path);
+			}
+
+			// copy ctor; copy assign
+			chunk_reader(const chunk_reader& reader) = delete;
+			chunk_reader& operator=(const chunk_reader& reader) = delete;
+
+			// O(1) | number of bytes not read yet
+			auto remaining() -> std::uint64_t
+			{
+				auto unread = static_cast<std::uint64_t>(len - pos);
+
+				// A failed stream has hit the end of the file
+				if (!stream)
+					return unread;
+
+				auto here = stream.tellg();
+				stream.seekg(0, std::ios::end);
+				auto end = stream.tellg();
+				stream.seekg(here);
+
+				return unread + static_cast<std::uint64_t>(end - here);
+			}
+
+			// Next line without its line break; false at the end of the file
+			auto next_line(const char*& first, const char*& last) -> bool
+			{
+				for (;;)
+				{
+					auto nl = static_cast<const char*>(std::memchr(buffer.data() + pos, '\n', len - pos));
+					if (nl != nullptr)
+					{
+						first = buffer.data() + pos;
+						last = nl;
+						pos = static_cast<size_t>(nl - buffer.data()) + 1;
+						return true;
+					}
+
+					if (!_refill())
+					{
+						// Last line without a line break
+						if (pos == len)
+							return false;
+
+						first = buffer.data() + pos;
+						last = buffer.data() + len;
+						pos = len;
+						return true;
+					}
+				}
+			}
+
+			// Reads exactly <bytes> bytes; false if the file is shorter
+			auto read(void* dst, size_t bytes) -> bool
+			{
+				auto out = static_cast<char*>(dst);
+
+				// Small reads are served from the chunk
+				while (len - pos < bytes && bytes <= buffer.size())
+					if (!_refill())
+						return false;
+
+				if (len - pos >= bytes)
+				{
+					std::memcpy(out, buffer.data() + pos, bytes);
+					pos += bytes;
+					return true;
+				}
+
+				// Large reads bypass the chunk, whatever was buffered goes first
+				auto buffered = std::min(bytes, len - pos);
+				std::memcpy(out, buffer.data() + pos, buffered);
+				pos += buffered;
+
+				if (buffered == bytes)
+					return true;
+
+				stream.read(out + buffered, static_cast<std::streamsize>(bytes - buffered));
+				return static_cast<size_t>(stream.gcount()) == bytes - buffered;
+			}
+		};
+
+		inline auto skip_blanks(const char*& it, const char* last) -> void
+		{
+			while (it != last && (*it == ' ' || *it == '\t' || *it == '\r'))
+				it++;
+		}
+
+		// Integral fields: optional sign and decimal digits
+		template <class N>
+		auto parse_field(const char*& it, const char* last, N& out, std::true_type) -> bool
+		{
+			bool negative{};
+
+			if (it != last && (*it == '-' || *it == '+'))
+			{
+				if (*it == '-' && !std::is_signed<N>::value)
+					return false;
+
+				negative = *it++ == '-';
+			}
+
+			if (it == last || *it < '0' || *it > '9')
+				return false;
+
+			// Magnitude of the lowest value is one past the highest one
+			const std::uintmax_t limit = static_cast<std::uintmax_t>(std::numeric_limits<N>::max()) + (negative ? 1 : 0);
+
+			std::uintmax_t value{};
+			while (it != last && *it >= '0' && *it <= '9')
+			{
+				std::uintmax_t digit = *it++ - '0';
+				if (digit > limit || value > (limit - digit) / 10)
+					return false;
+
+				value = value * 10 + digit;
+			}
+
+			// -(value - 1) - 1: the lowest value doesn't overflow on the way
+			out = negative && value != 0 ? static_cast<N>(-static_cast<N>(value - 1) - 1) : static_cast<N>(value);
+
+			return true;
+		}
+
+		// Floating-point fields: token is copied out, so strtod doesn't run past the line
+		template <class N>
+		auto parse_field(const char*& it, const char* last, N& out, std::false_type) -> bool
+		{
+			char token[64];
+			size_t n{};
+
+			while (it != last && *it != ' ' && *it != '\t' && *it != '\r')
+			{
+				// Over-long tokens are rejected rather than cut
+				if (n == sizeof(token) - 1)
+					return false;
+
+				token[n++] = *it++;
+			}
+			token[n] = '\0';
+
+			char* end{};
+			auto value = std::strtod(token, &end);
+			if (n == 0 || end != token + n)
+				return false;
+
+			out = static_cast<N>(value);
+
+			return true;
+		}
+
+		// Reads the next whitespace-separated field of a line
+		template <class N>
+		auto parse_field(const char*& it, const char* last, N& out) -> bool
+		{
+			static_assert(std::is_integral<N>::value || std::is_floating_point<N>::value,
+				"Only numeric or std::string fields can be parsed");
+
+			skip_blanks(it, last);
+			return parse_field(it, last, out, std::integral_constant<bool, std::is_integral<N>::value>());
+		}
+
+		inline auto parse_field(const char*& it, const char* last, std::string& out) -> bool
+		{
+			skip_blanks(it, last);
+
+			auto first = it;
+			while (it != last && *it != ' ' && *it != '\t' && *it != '\r')
+				it++;
+
+			out.assign(first, it);
+
+			return first != it;
+		}
+
+	}
+
+}
\ No newline at end of file
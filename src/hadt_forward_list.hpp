@@ -18,6 +18,9 @@
 // std::initializer_list
 #include <initializer_list>
 
+// placement new, ::operator new, ::operator delete
+#include <new>
+
 #include "hadt_common.hpp"
 
 namespace hadt {
@@ -84,6 +87,14 @@ namespace hadt {
 
 		size_t size_;
 
+		// Contiguous block of nodes built by compact()
+		HNode<T> *node_block;
+		size_t node_block_size;
+
+		// Node allocation hooks; containers with their own node storage override these
+		virtual auto _new_node(T&& data) -> HNode<T>*;
+		virtual auto _delete_node(HNode<T>* node) throw() -> void;
+
 	public:
 
 		typedef std::forward_iterator_tag iterator_category;
@@ -94,7 +105,9 @@ namespace hadt {
 		forward_list() :
 			head{ nullptr },
 			tail{ nullptr },
-			tail_junk{ nullptr } {};
+			tail_junk{ nullptr },
+			node_block{ nullptr },
+			node_block_size{ 0 } {};
 
 		virtual ~forward_list() throw() { clear(); }
 
@@ -178,6 +191,9 @@ namespace hadt {
 		inline auto size() const -> size_t { return size_; };
 		inline auto empty() -> bool { return begin() == end(); };
 
+		// O(n) | relinks all nodes into one contiguous block following the logical order
+		virtual auto compact() -> void;
+
 		// Print list
 		auto print(std::ostream& ostream = std::cout) const -> std::ostream&;
 		virtual auto print_reverse(std::ostream& ostream = std::cout) -> std::ostream&;
@@ -199,13 +215,32 @@ namespace hadt {
 	};
 
 
+	template <class T>
+	auto forward_list<T>::_new_node(T&& data) -> HNode<T>*
+	{
+		return new HNode<T>(std::move(data));
+	}
+
+	template <class T>
+	auto forward_list<T>::_delete_node(HNode<T>* node) throw() -> void
+	{
+		// Nodes from the compacted block are released all at once
+		if (node >= node_block && node < node_block + node_block_size)
+		{
+			node->~HNode<T>();
+			return;
+		}
+
+		delete node;
+	}
+
 	template <class T>
 	auto forward_list<T>::_push_front(T&& data) throw() -> void
 	{
-		HNode<T> *node = new HNode<T>(std::move(data));
+		HNode<T> *node = _new_node(std::move(data));
 
 		if (nullptr == tail_junk)
-			tail_junk = new HNode<T>(T{ 55 }, nullptr, nullptr);
+			tail_junk = _new_node(T{ 55 });
 
 		// Head
 		if (nullptr != head)
@@ -238,10 +273,10 @@ namespace hadt {
 	template <class T>
 	auto forward_list<T>::_push_back(T&& data) throw() -> void
 	{
-		HNode<T> *node = new HNode<T>(std::move(data));
+		HNode<T> *node = _new_node(std::move(data));
 
 		if (tail_junk == nullptr)
-			tail_junk = new HNode<T>(T{}, nullptr, nullptr);
+			tail_junk = _new_node(T{});
 
 		// Tail
 		if (nullptr != tail)
@@ -358,14 +393,19 @@ namespace hadt {
 			while (tmp != tail_junk)
 			{
 				tmp = it->next;
-				delete it;
+				_delete_node(it);
 				it = tmp;
 			}
 
 			if (nullptr != tail_junk)
-				delete tail_junk;
+				_delete_node(tail_junk);
+
+			if (nullptr != node_block)
+				::operator delete(node_block);
 
 			head = tail = tail_junk = nullptr;
+			node_block = nullptr;
+			node_block_size = 0;
 
 			size_ = 0;
 		}
@@ -397,7 +437,7 @@ namespace hadt {
 				HNode<T> * tmp = head;
 				head = head->next;
 
-				delete tmp;
+				_delete_node(tmp);
 
 				size_--;
 			}
@@ -421,7 +461,7 @@ namespace hadt {
 				prev->next = tail_junk;
 				tail = prev;
 
-				delete tmp;
+				_delete_node(tmp);
 
 				size_--;
 			}
@@ -438,7 +478,7 @@ namespace hadt {
 
 			prev->next = next;
 
-			delete curr;
+			_delete_node(curr);
 
 			size_--;
 		}
@@ -580,6 +620,44 @@ namespace hadt {
 		head = curr;
 	}
 
+	template <class T>
+	auto forward_list<T>::compact() -> void
+	{
+		if (empty()) return;
+
+		HNode<T> *block = static_cast<HNode<T>*>(::operator new(size() * sizeof(HNode<T>)));
+
+		HNode<T> *curr = head, *succ{};
+		HNode<T> *pred{};
+		size_t idx{};
+
+		// Move data into the block in logical order and release old nodes on the way
+		while (curr != tail_junk)
+		{
+			HNode<T> *node = new (&block[idx++]) HNode<T>(std::move(curr->data), tail_junk, nullptr);
+
+			if (nullptr == pred)
+				head = node;
+			else
+				pred->next = node;
+
+			pred = node;
+
+			succ = curr->next;
+			_delete_node(curr);
+			curr = succ;
+		}
+
+		tail = pred;
+
+		// Previous block (if any) holds no live nodes at this point
+		if (nullptr != node_block)
+			::operator delete(node_block);
+
+		node_block = block;
+		node_block_size = size();
+	}
+
 	template <class T>
 	auto forward_list<T>::reverse(forward_list<T>& ref) -> void
 	{
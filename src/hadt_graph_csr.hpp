@@ -0,0 +1,1003 @@
+#pragma once
+
+// std::out_of_range, std::domain_error, std::invalid_argument
+#include <stdexcept>
+
+// std::move, std::pair, std::make_pair
+#include <utility>
+
+// std::function
+#include <functional>
+
+// std::vector
+#include <vector>
+
+// std::deque
+#include <deque>
+
+// std::uint32_t, std::uint64_t
+#include <cstdint>
+
+// std::thread
+#include <thread>
+
+// std::atomic, std::memory_order_relaxed
+#include <atomic>
+
+// std::unique_ptr
+#include <memory>
+
+// std::min, std::max, std::fill, std::reverse
+#include <algorithm>
+
+// std::numeric_limits
+#include <limits>
+
+// std::chrono::steady_clock, std::chrono::duration
+#include <chrono>
+
+// std::abs
+#include <cmath>
+
+#include "hadt_common.hpp"
+
+// hadt::dary_heap
+#include "./hadt_dary_heap.hpp"
+
+// hadt::parallel_for
+#include "./hadt_parallel.hpp"
+
+namespace hadt {
+
+	/* Immutable compressed-sparse-row snapshot of a graph (see graph_list::freeze()):
+	 *   -- vertex <v> payload is vertices[v]
+	 *   -- edges of <v> are [offsets[v], offsets[v + 1]) in targets/weights arrays
+	 * Vertex/edge order is the one graph_list had at the moment of freezing.
+	 * Targets and weights are separate arrays, so weight-only passes stream a single array.
+	 * Structure is fixed; payloads and weights may still be updated by vertex_map/edge_map.
+	 * Traversals keep their visited state locally, so a snapshot can be read concurrently.
+	 * build_reverse() adds incoming-edge arrays in the same layout (used by bottom-up BFS steps).
+	 */
+	template <class T, class W>
+	class graph_csr
+	{
+	public:
+
+		typedef std::uint32_t index_type;
+
+	protected:
+
+		std::vector<T> vertices_;
+		std::vector<size_t> offsets_;
+		std::vector<index_type> targets_;
+		std::vector<W> weights_;
+
+		// Reverse adjacency (empty until build_reverse()): sources of <v> are [in_offsets[v], in_offsets[v + 1])
+		std::vector<size_t> in_offsets_;
+		std::vector<index_type> sources_;
+
+	public:
+
+		// Means "no such vertex"
+		static const index_type npos = UINT32_MAX;
+
+		graph_csr() : offsets_(1, 0) {};
+		graph_csr(std::vector<T>&& vertices, std::vector<size_t>&& offsets,
+			std::vector<index_type>&& targets, std::vector<W>&& weights) :
+			vertices_(std::move(vertices)),
+			offsets_(std::move(offsets)),
+			targets_(std::move(targets)),
+			weights_(std::move(weights)) {};
+
+		// copy ctor; copy assign
+		graph_csr(const graph_csr& csr) = delete;
+		graph_csr& operator=(const graph_csr& csr) = delete;
+
+		// move ctor; move assign
+		graph_csr(graph_csr&& csr) :
+			vertices_(std::move(csr.vertices_)),
+			offsets_(std::move(csr.offsets_)),
+			targets_(std::move(csr.targets_)),
+			weights_(std::move(csr.weights_)),
+			in_offsets_(std::move(csr.in_offsets_)),
+			sources_(std::move(csr.sources_)) {};
+
+		graph_csr& operator=(graph_csr&& csr)
+		{
+			vertices_ = std::move(csr.vertices_);
+			offsets_ = std::move(csr.offsets_);
+			targets_ = std::move(csr.targets_);
+			weights_ = std::move(csr.weights_);
+			in_offsets_ = std::move(csr.in_offsets_);
+			sources_ = std::move(csr.sources_);
+
+			return *this;
+		}
+
+		// Raw arrays
+		auto vertices() const -> const std::vector<T>& { return vertices_; }
+		auto offsets() const -> const std::vector<size_t>& { return offsets_; }
+		auto targets() const -> const std::vector<index_type>& { return targets_; }
+		auto weights() const -> const std::vector<W>& { return weights_; }
+		auto in_offsets() const -> const std::vector<size_t>& { return in_offsets_; }
+		auto sources() const -> const std::vector<index_type>& { return sources_; }
+
+		// Result of parallel_bfs(): per-vertex level and parent (npos if unreached, start is its own parent)
+		// and reached vertices grouped by level
+		struct bfs_tree
+		{
+			std::vector<index_type> levels;
+			std::vector<index_type> parents;
+			std::vector<index_type> order;
+		};
+
+		// Result of shortest path searches: per-vertex distance from the source (unreachable() if none)
+		// and predecessor (npos if unreachable, source is its own predecessor)
+		struct path_tree
+		{
+			std::vector<W> distances;
+			std::vector<index_type> parents;
+		};
+
+		// Result of pagerank(): per-vertex rank (ranks sum up to 1), number of iterations run,
+		// L1 change of the last one and wall-clock seconds spent in each
+		struct pagerank_result
+		{
+			std::vector<double> ranks;
+			size_t iterations;
+			double residual;
+			std::vector<double> iteration_seconds;
+		};
+
+		// Graph Traversal (starting from <start> vertex)
+		auto bfs_vertex_map(std::function<void(T&)> map_func, index_type start = 0) throw(std::out_of_range) -> void; // Breadth-First Search
+		auto dfs_vertex_map(std::function<void(T&)> map_func, index_type start = 0) throw(std::out_of_range) -> void; // Depth-First-Search
+
+		// O(V + E) | level-synchronous BFS on <threads> threads (0 means all cores). Frontier is expanded
+		// top-down and, once reverse adjacency is built, switches to bottom-up steps while it is large
+		auto parallel_bfs(index_type start = 0, unsigned threads = 0) const throw(std::out_of_range) -> bfs_tree;
+
+		// MS-BFS: sources are processed in batches of <lanes> (rounded up to whole 64-bit words, at most 512).
+		// Every vertex keeps one bit per source of the batch, so each edge is scanned once per level for
+		// the whole batch. O(S / lanes * D * (V + E) * lanes / 64) for S sources and depth D.
+		// Returns per-source hop counts: result[i][v] is the distance from sources[i] to <v> (npos if unreached)
+		auto multi_source_bfs(const std::vector<index_type>& sources, size_t lanes = 256) const throw(std::out_of_range)
+			-> std::vector<std::vector<index_type>>;
+
+		// Numeric kernels (rows are split between <threads> threads, 0 means all cores)
+
+		// O(E) | sparse matrix-vector product y = A * x, where A[u][v] is the weight of u -> v
+		// (parallel edges add up); <y> is resized to size()
+		template <class V>
+		auto spmv(const std::vector<V>& x, std::vector<V>& y, unsigned threads = 0) const throw(std::invalid_argument) -> void;
+
+		// O(E) per iteration | PageRank by power iteration over incoming edges (weights are ignored,
+		// rank of vertices without edges is spread evenly). Stops once the L1 change of an iteration
+		// drops to <tolerance> or after <max_iterations>. Uses reverse adjacency if it's built,
+		// otherwise a temporary copy is made
+		auto pagerank(double damping = 0.85, double tolerance = 1e-6, size_t max_iterations = 100, unsigned threads = 0) const
+			throw(std::invalid_argument) -> pagerank_result;
+
+		// O(V + E) | builds reverse adjacency arrays
+		auto build_reverse() -> void;
+		inline auto has_reverse() const -> bool { return !in_offsets_.empty(); };
+
+		// Shortest paths over edge weights
+
+		// Distance of vertices that can't be reached
+		static auto unreachable() -> W;
+
+		// O((V + E) log V) | Dijkstra over a 4-ary heap; weights must be non-negative
+		auto dijkstra(index_type source) const throw(std::out_of_range) -> path_tree;
+		// O(V * E) worst case | queue-based Bellman-Ford (SPFA); negative weights are allowed,
+		// negative cycles reachable from the source are reported with std::domain_error
+		auto bellman_ford(index_type source) const throw(std::out_of_range, std::domain_error) -> path_tree;
+		// O(E) + one of the above | picks Bellman-Ford only if there are negative weights
+		auto shortest_paths(index_type source) const throw(std::out_of_range, std::domain_error) -> path_tree;
+
+		// Point-to-point Dijkstra, stops as soon as <to> is settled. <path> gets vertices from <from>
+		// to <to> (empty if <to> can't be reached). Returns the distance
+		auto shortest_path(index_type from, index_type to, std::vector<index_type>& path) const throw(std::out_of_range) -> W;
+
+		// Functional Programming (FP) Routines
+
+		// Apply <map> function to all vertices
+		auto vertex_map(std::function<void(T&)> map_func) -> void;
+		// Apply <fold> function to all vertices
+		template <class Res> auto vertex_fold(T& acc, std::function<Res(T)> fold_func) -> void;
+
+		// Apply <map> function to all edges of a given vertex
+		auto edge_map(index_type vertex, std::function<void(W&)> map_func) throw(std::out_of_range) -> void;
+		// Apply <fold> function to all edges of a given vertex
+		template <class Res>
+		auto edge_fold(W& acc, index_type vertex, std::function<Res(W)> fold_func) throw(std::out_of_range) -> void;
+
+		// Same routines for any callable (picked for lambdas unless <Res> is given explicitly).
+		// Weights of a vertex are one contiguous run, so with an inlinable callable these are
+		// plain array loops the compiler can vectorize for arithmetic W
+		template <class Map>
+		auto edge_map(index_type vertex, Map&& map_func) throw(std::out_of_range) -> void;
+		template <class Fold>
+		auto edge_fold(W& acc, index_type vertex, Fold&& fold_func) throw(std::out_of_range) -> void;
+
+		// O(E) | same over the weights of all edges at once
+		template <class Map> auto weight_map(Map&& map_func) -> void;
+		template <class Fold> auto weight_fold(W& acc, Fold&& fold_func) const -> void;
+
+		// O(1) | [first, last) of a vertex's edge weights and targets (parallel arrays)
+		auto edge_weights(index_type vertex) throw(std::out_of_range) -> std::pair<W*, W*>;
+		auto edge_weights(index_type vertex) const throw(std::out_of_range) -> std::pair<const W*, const W*>;
+		auto edge_targets(index_type vertex) const throw(std::out_of_range) -> std::pair<const index_type*, const index_type*>;
+
+		/* Service functions */
+
+		// O(1) | returns vertex count
+		inline auto size() const -> size_t { return vertices_.size(); };
+		// O(1) | returns total edge count
+		inline auto edge_count() const -> size_t { return targets_.size(); };
+		// O(1) | returns given vertex's edge count
+		auto edge_size(index_type vertex) const throw(std::out_of_range) -> size_t;
+
+		inline auto empty() const -> bool { return vertices_.empty(); };
+
+		// O(1) | returns vertex payload
+		auto vertex_data(index_type vertex) const throw(std::out_of_range) -> const T&;
+
+		// O(n) | returns index of the first vertex with the given value (npos if not found)
+		auto find_vertex(const T& data_to_find) const -> index_type;
+
+	private:
+
+		auto _check(index_type vertex) const throw(std::out_of_range) -> void;
+
+		// Fills reverse adjacency arrays in the layout of in_offsets_/sources_
+		auto _reverse(std::vector<size_t>& in_offsets, std::vector<index_type>& sources) const -> void;
+
+		// Dijkstra stopping once <target> is settled (npos: settle everything)
+		auto _dijkstra(index_type source, index_type target) const -> path_tree;
+	};
+
+	template <class T, class W>
+	const typename graph_csr<T, W>::index_type graph_csr<T, W>::npos;
+
+	template <class T, class W>
+	auto graph_csr<T, W>::_check(index_type vertex) const throw(std::out_of_range) -> void
+	{
+		if (vertex >= size())
+			throw std::out_of_range("Vertex index is out of range");
+	}
+
+	template <class T, class W>
+	auto graph_csr<T, W>::bfs_vertex_map(std::function<void(T&)> map_func, index_type start) throw(std::out_of_range) -> void
+	{
+		if (empty()) return;
+
+		_check(start);
+
+		std::vector<bool> visited(size(), false);
+		std::deque<index_type> v_list;
+
+		index_type node;
+
+		// Push to Back ...
+		v_list.push_back(start);
+		while (!v_list.empty())
+		{
+			// ... and Pull from Front
+			node = v_list.front();
+			v_list.pop_front();
+
+			if (visited[node])
+				continue;
+
+			map_func(vertices_[node]);
+			visited[node] = true;
+
+			for (size_t e = offsets_[node]; e < offsets_[node + 1]; e++)
+				if (!visited[targets_[e]])
+					v_list.push_back(targets_[e]);
+		}
+	}
+
+	template <class T, class W>
+	auto graph_csr<T, W>::dfs_vertex_map(std::function<void(T&)> map_func, index_type start) throw(std::out_of_range) -> void
+	{
+		if (empty()) return;
+
+		_check(start);
+
+		std::vector<bool> visited(size(), false);
+		std::vector<index_type> v_list;
+
+		index_type node;
+
+		v_list.push_back(start);
+		while (!v_list.empty())
+		{
+			node = v_list.back();
+			v_list.pop_back();
+
+			if (visited[node])
+				continue;
+
+			map_func(vertices_[node]);
+			visited[node] = true;
+
+			// Put childs in reverse order to visit them from left to right
+			for (size_t e = offsets_[node + 1]; e > offsets_[node]; e--)
+				if (!visited[targets_[e - 1]])
+					v_list.push_back(targets_[e - 1]);
+		}
+	}
+
+	template <class T, class W>
+	auto graph_csr<T, W>::multi_source_bfs(const std::vector<index_type>& sources, size_t lanes) const throw(std::out_of_range)
+		-> std::vector<std::vector<index_type>>
+	{
+		for (auto s : sources)
+			_check(s);
+
+		const size_t n = size();
+		const size_t max_words = std::min<size_t>(8, std::max<size_t>(1, (lanes + 63) / 64));
+
+		std::vector<std::vector<index_type>> distances(sources.size(), std::vector<index_type>(n, npos));
+
+		// Per-vertex bit rows: sources that have reached it, that reached it on the last level, on the next one
+		std::vector<std::uint64_t> seen, visit, next;
+
+		for (size_t batch = 0; batch < sources.size(); batch += max_words * 64)
+		{
+			const size_t count = std::min(max_words * 64, sources.size() - batch);
+			const size_t words = (count + 63) / 64;
+
+			seen.assign(n * words, 0);
+			visit.assign(n * words, 0);
+			next.assign(n * words, 0);
+
+			for (size_t i = 0; i < count; i++)
+			{
+				auto s = sources[batch + i];
+				auto bit = std::uint64_t{ 1 } << (i & 63);
+
+				seen[s * words + (i >> 6)] |= bit;
+				visit[s * words + (i >> 6)] |= bit;
+				distances[batch + i][s] = 0;
+			}
+
+			bool active = true;
+			for (index_type level = 1; active; level++)
+			{
+				// Push: a single scan of every edge carries all sources of the batch
+				for (size_t u = 0; u < n; u++)
+				{
+					auto from = &visit[u * words];
+
+					std::uint64_t any{};
+					for (size_t w = 0; w < words; w++)
+						any |= from[w];
+
+					if (any == 0)
+						continue;
+
+					for (size_t e = offsets_[u]; e < offsets_[u + 1]; e++)
+					{
+						auto to = &next[targets_[e] * words];
+						for (size_t w = 0; w < words; w++)
+							to[w] |= from[w];
+					}
+				}
+
+				// Keep only sources that reach a vertex for the first time
+				active = false;
+				for (size_t v = 0; v < n; v++)
+				{
+					auto reached = &next[v * words];
+					auto known = &seen[v * words];
+
+					for (size_t w = 0; w < words; w++)
+					{
+						auto fresh = reached[w] & ~known[w];
+						reached[w] = fresh;
+
+						if (fresh == 0)
+							continue;
+
+						known[w] |= fresh;
+						active = true;
+
+						for (; fresh != 0; fresh &= fresh - 1)
+							distances[batch + w * 64 + lowest_bit(fresh)][v] = level;
+					}
+				}
+
+				visit.swap(next);
+				std::fill(next.begin(), next.end(), 0);
+			}
+		}
+
+		return distances;
+	}
+
+	template <class T, class W>
+	auto graph_csr<T, W>::build_reverse() -> void
+	{
+		_reverse(in_offsets_, sources_);
+	}
+
+	template <class T, class W>
+	auto graph_csr<T, W>::_reverse(std::vector<size_t>& in_offsets, std::vector<index_type>& sources) const -> void
+	{
+		in_offsets.assign(size() + 1, 0);
+		sources.resize(edge_count());
+
+		// Count incoming edges ...
+		for (auto t : targets_)
+			in_offsets[t + 1]++;
+
+		for (size_t v = 0; v < size(); v++)
+			in_offsets[v + 1] += in_offsets[v];
+
+		// ... and scatter sources (row by row, so sources of every vertex stay sorted)
+		std::vector<size_t> fill(in_offsets.begin(), in_offsets.end() - 1);
+		for (size_t u = 0; u < size(); u++)
+			for (size_t e = offsets_[u]; e < offsets_[u + 1]; e++)
+				sources[fill[targets_[e]]++] = static_cast<index_type>(u);
+	}
+
+	template <class T, class W>
+	template <class V>
+	auto graph_csr<T, W>::spmv(const std::vector<V>& x, std::vector<V>& y, unsigned threads) const throw(std::invalid_argument) -> void
+	{
+		if (x.size() != size())
+			throw std::invalid_argument("Vector size doesn't match vertex count");
+
+		y.resize(size());
+
+		// Rows are independent: every thread writes its own slice of <y>
+		parallel_for(size(), threads, [this, &x, &y](size_t first, size_t last, unsigned) {
+			for (size_t u = first; u < last; u++)
+			{
+				V sum{};
+				for (size_t e = offsets_[u]; e < offsets_[u + 1]; e++)
+					sum += static_cast<V>(weights_[e]) * x[targets_[e]];
+
+				y[u] = sum;
+			}
+		});
+	}
+
+	template <class T, class W>
+	auto graph_csr<T, W>::pagerank(double damping, double tolerance, size_t max_iterations, unsigned threads) const
+		throw(std::invalid_argument) -> pagerank_result
+	{
+		if (!(damping >= 0.0 && damping <= 1.0))
+			throw std::invalid_argument("Damping factor has to be in [0, 1]");
+
+		if (!(tolerance >= 0.0))
+			throw std::invalid_argument("Tolerance can't be negative");
+
+		const size_t n = size();
+
+		pagerank_result result;
+		result.iterations = 0;
+		result.residual = 0.0;
+
+		if (n == 0)
+			return result;
+
+		// Pull over incoming edges, so every vertex is written by one thread only
+		std::vector<size_t> local_offsets;
+		std::vector<index_type> local_sources;
+		if (!has_reverse())
+			_reverse(local_offsets, local_sources);
+
+		const auto& in_offsets = has_reverse() ? in_offsets_ : local_offsets;
+		const auto& sources = has_reverse() ? sources_ : local_sources;
+
+		const size_t parts = parallel_parts(n, threads);
+
+		std::vector<double> ranks(n, 1.0 / n), next(n), share(n);
+		std::vector<double> partial(parts);
+
+		while (result.iterations < max_iterations)
+		{
+			auto started = std::chrono::steady_clock::now();
+
+			// Share every vertex passes along each of its edges; dangling vertices give to everyone
+			parallel_for(n, threads, [&](size_t first, size_t last, unsigned part) {
+				double dangling{};
+
+				for (size_t u = first; u < last; u++)
+				{
+					auto degree = offsets_[u + 1] - offsets_[u];
+					if (degree == 0)
+					{
+						share[u] = 0.0;
+						dangling += ranks[u];
+					}
+					else
+						share[u] = ranks[u] / degree;
+				}
+
+				partial[part] = dangling;
+			});
+
+			double dangling{};
+			for (auto p : partial)
+				dangling += p;
+
+			const double base = (1.0 - damping) / n + damping * dangling / n;
+
+			parallel_for(n, threads, [&](size_t first, size_t last, unsigned part) {
+				double change{};
+
+				for (size_t v = first; v < last; v++)
+				{
+					double sum{};
+					for (size_t e = in_offsets[v]; e < in_offsets[v + 1]; e++)
+						sum += share[sources[e]];
+
+					next[v] = base + damping * sum;
+					change += std::abs(next[v] - ranks[v]);
+				}
+
+				partial[part] = change;
+			});
+
+			ranks.swap(next);
+
+			result.residual = 0.0;
+			for (auto p : partial)
+				result.residual += p;
+
+			result.iterations++;
+			result.iteration_seconds.push_back(
+				std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count());
+
+			if (result.residual <= tolerance)
+				break;
+		}
+
+		result.ranks = std::move(ranks);
+
+		return result;
+	}
+
+	template <class T, class W>
+	auto graph_csr<T, W>::parallel_bfs(index_type start, unsigned threads) const throw(std::out_of_range) -> bfs_tree
+	{
+		_check(start);
+
+		// Direction switching thresholds (Beamer et al.)
+		const size_t alpha = 14, beta = 24;
+
+		if (threads == 0)
+			threads = std::max(1u, std::thread::hardware_concurrency());
+
+		const size_t n = size();
+		const size_t words = (n + 63) / 64;
+
+		bfs_tree tree;
+		tree.levels.assign(n, npos);
+
+		// Vertex is claimed by whoever sets its parent first
+		std::unique_ptr<std::atomic<index_type>[]> parents(new std::atomic<index_type>[n]);
+		for (size_t v = 0; v < n; v++)
+			parents[v].store(npos, std::memory_order_relaxed);
+
+		parents[start].store(start, std::memory_order_relaxed);
+		tree.levels[start] = 0;
+
+		std::vector<index_type> frontier(1, start);
+		std::vector<std::uint64_t> front_bits, next_bits;
+		std::vector<std::vector<index_type>> local_next(threads);
+		std::vector<size_t> local_count(threads), local_edges(threads);
+
+		size_t frontier_size = 1;
+		size_t frontier_edges = offsets_[start + 1] - offsets_[start];
+		size_t unexplored_edges = edge_count() - frontier_edges;
+		bool bottom_up = false;
+		index_type depth = 0;
+
+		while (frontier_size > 0)
+		{
+			if (!bottom_up && has_reverse() && frontier_edges > unexplored_edges / alpha)
+			{
+				// Queue -> bitmap
+				front_bits.assign(words, 0);
+				next_bits.assign(words, 0);
+				for (auto u : frontier)
+					front_bits[u >> 6] |= std::uint64_t{ 1 } << (u & 63);
+
+				bottom_up = true;
+			}
+			else if (bottom_up && frontier_size < n / beta)
+			{
+				// Bitmap -> queue
+				frontier.clear();
+				for (size_t w = 0; w < words; w++)
+					for (size_t bit = 0; bit < 64; bit++)
+						if ((front_bits[w] >> bit) & 1)
+							frontier.push_back(static_cast<index_type>(w * 64 + bit));
+
+				bottom_up = false;
+			}
+
+			std::fill(local_count.begin(), local_count.end(), 0);
+			std::fill(local_edges.begin(), local_edges.end(), 0);
+
+			if (bottom_up)
+			{
+				// Every unvisited vertex looks for a parent in the frontier; each thread owns whole words
+				parallel_for(words, threads, [&](size_t first, size_t last, unsigned part) {
+					size_t count{}, edges{};
+
+					for (size_t w = first; w < last; w++)
+					{
+						std::uint64_t word{};
+
+						for (size_t v = w * 64; v < std::min(n, w * 64 + 64); v++)
+						{
+							if (parents[v].load(std::memory_order_relaxed) != npos)
+								continue;
+
+							for (size_t e = in_offsets_[v]; e < in_offsets_[v + 1]; e++)
+							{
+								auto u = sources_[e];
+								if ((front_bits[u >> 6] >> (u & 63)) & 1)
+								{
+									parents[v].store(u, std::memory_order_relaxed);
+									tree.levels[v] = depth + 1;
+									word |= std::uint64_t{ 1 } << (v & 63);
+									count++;
+									edges += offsets_[v + 1] - offsets_[v];
+									break;
+								}
+							}
+						}
+
+						next_bits[w] = word;
+					}
+
+					local_count[part] = count;
+					local_edges[part] = edges;
+				});
+
+				front_bits.swap(next_bits);
+			}
+			else
+			{
+				// Frontier vertices claim their unvisited children
+				parallel_for(frontier.size(), threads, [&](size_t first, size_t last, unsigned part) {
+					auto &next = local_next[part];
+					size_t edges{};
+
+					for (size_t i = first; i < last; i++)
+					{
+						auto u = frontier[i];
+						for (size_t e = offsets_[u]; e < offsets_[u + 1]; e++)
+						{
+							auto v = targets_[e];
+							auto expected = npos;
+
+							if (parents[v].load(std::memory_order_relaxed) == npos &&
+								parents[v].compare_exchange_strong(expected, u, std::memory_order_relaxed))
+							{
+								tree.levels[v] = depth + 1;
+								next.push_back(v);
+								edges += offsets_[v + 1] - offsets_[v];
+							}
+						}
+					}
+
+					local_count[part] = next.size();
+					local_edges[part] = edges;
+				});
+
+				frontier.clear();
+				for (auto &next : local_next)
+				{
+					frontier.insert(frontier.end(), next.begin(), next.end());
+					next.clear();
+				}
+			}
+
+			frontier_size = frontier_edges = 0;
+			for (unsigned t = 0; t < threads; t++)
+			{
+				frontier_size += local_count[t];
+				frontier_edges += local_edges[t];
+			}
+
+			unexplored_edges -= frontier_edges;
+			depth++;
+		}
+
+		tree.parents.resize(n);
+		for (size_t v = 0; v < n; v++)
+			tree.parents[v] = parents[v].load(std::memory_order_relaxed);
+
+		// Counting sort by level (deepest level is depth - 1)
+		std::vector<size_t> level_start(depth + 1, 0);
+		for (auto level : tree.levels)
+			if (level != npos)
+				level_start[level + 1]++;
+
+		for (size_t l = 0; l < depth; l++)
+			level_start[l + 1] += level_start[l];
+
+		tree.order.resize(level_start[depth]);
+		for (size_t v = 0; v < n; v++)
+			if (tree.levels[v] != npos)
+				tree.order[level_start[tree.levels[v]]++] = static_cast<index_type>(v);
+
+		return tree;
+	}
+
+	template <class T, class W>
+	auto graph_csr<T, W>::unreachable() -> W
+	{
+		return std::numeric_limits<W>::has_infinity ? std::numeric_limits<W>::infinity() : std::numeric_limits<W>::max();
+	}
+
+	template <class T, class W>
+	auto graph_csr<T, W>::_dijkstra(index_type source, index_type target) const -> path_tree
+	{
+		path_tree tree;
+		tree.distances.assign(size(), unreachable());
+		tree.parents.assign(size(), npos);
+
+		dary_heap<W> heap(size());
+
+		tree.distances[source] = W{};
+		tree.parents[source] = source;
+		heap.push_or_decrease(source, W{});
+
+		while (!heap.empty())
+		{
+			auto u = heap.pop();
+
+			// Popped vertex is settled: nothing can shorten its path anymore
+			if (u == target)
+				break;
+
+			for (size_t e = offsets_[u]; e < offsets_[u + 1]; e++)
+			{
+				auto v = targets_[e];
+				auto dist = tree.distances[u] + weights_[e];
+
+				if (dist < tree.distances[v])
+				{
+					tree.distances[v] = dist;
+					tree.parents[v] = u;
+					heap.push_or_decrease(v, dist);
+				}
+			}
+		}
+
+		return tree;
+	}
+
+	template <class T, class W>
+	auto graph_csr<T, W>::dijkstra(index_type source) const throw(std::out_of_range) -> path_tree
+	{
+		_check(source);
+
+		return _dijkstra(source, npos);
+	}
+
+	template <class T, class W>
+	auto graph_csr<T, W>::bellman_ford(index_type source) const throw(std::out_of_range, std::domain_error) -> path_tree
+	{
+		_check(source);
+
+		path_tree tree;
+		tree.distances.assign(size(), unreachable());
+		tree.parents.assign(size(), npos);
+
+		std::deque<index_type> queue;
+		std::vector<bool> queued(size(), false);
+		// Edge count of the current best path to every vertex
+		std::vector<size_t> hops(size(), 0);
+
+		tree.distances[source] = W{};
+		tree.parents[source] = source;
+		queue.push_back(source);
+		queued[source] = true;
+
+		while (!queue.empty())
+		{
+			auto u = queue.front();
+			queue.pop_front();
+			queued[u] = false;
+
+			for (size_t e = offsets_[u]; e < offsets_[u + 1]; e++)
+			{
+				auto v = targets_[e];
+				auto dist = tree.distances[u] + weights_[e];
+
+				if (dist < tree.distances[v])
+				{
+					tree.distances[v] = dist;
+					tree.parents[v] = u;
+
+					// Simple paths have less than V edges
+					hops[v] = hops[u] + 1;
+					if (hops[v] >= size())
+						throw std::domain_error("Negative cycle is reachable from the source");
+
+					if (!queued[v])
+					{
+						queue.push_back(v);
+						queued[v] = true;
+					}
+				}
+			}
+		}
+
+		return tree;
+	}
+
+	template <class T, class W>
+	auto graph_csr<T, W>::shortest_paths(index_type source) const throw(std::out_of_range, std::domain_error) -> path_tree
+	{
+		for (auto &w : weights_)
+			if (w < W{})
+				return bellman_ford(source);
+
+		return dijkstra(source);
+	}
+
+	template <class T, class W>
+	auto graph_csr<T, W>::shortest_path(index_type from, index_type to, std::vector<index_type>& path) const throw(std::out_of_range) -> W
+	{
+		_check(from);
+		_check(to);
+
+		auto tree = _dijkstra(from, to);
+
+		path.clear();
+		if (tree.parents[to] == npos)
+			return unreachable();
+
+		// Walk predecessors back to the source
+		for (auto v = to; v != from; v = tree.parents[v])
+			path.push_back(v);
+
+		path.push_back(from);
+		std::reverse(path.begin(), path.end());
+
+		return tree.distances[to];
+	}
+
+	template <class T, class W>
+	auto graph_csr<T, W>::vertex_map(std::function<void(T&)> map_func) -> void
+	{
+		for (auto &v : vertices_)
+			map_func(v);
+	}
+
+	template <class T, class W>
+	template <class Res>
+	auto graph_csr<T, W>::vertex_fold(T& acc, std::function<Res(T)> fold_func) -> void
+	{
+		for (auto &v : vertices_)
+			acc += fold_func(v);
+	}
+
+	template <class T, class W>
+	auto graph_csr<T, W>::edge_map(index_type vertex, std::function<void(W&)> map_func) throw(std::out_of_range) -> void
+	{
+		_check(vertex);
+
+		for (size_t e = offsets_[vertex]; e < offsets_[vertex + 1]; e++)
+			map_func(weights_[e]);
+	}
+
+	template <class T, class W>
+	template <class Res>
+	auto graph_csr<T, W>::edge_fold(W& acc, index_type vertex, std::function<Res(W)> fold_func) throw(std::out_of_range) -> void
+	{
+		_check(vertex);
+
+		for (size_t e = offsets_[vertex]; e < offsets_[vertex + 1]; e++)
+			acc += fold_func(weights_[e]);
+	}
+
+	template <class T, class W>
+	template <class Map>
+	auto graph_csr<T, W>::edge_map(index_type vertex, Map&& map_func) throw(std::out_of_range) -> void
+	{
+		auto row = edge_weights(vertex);
+
+		for (auto w = row.first; w != row.second; w++)
+			map_func(*w);
+	}
+
+	template <class T, class W>
+	template <class Fold>
+	auto graph_csr<T, W>::edge_fold(W& acc, index_type vertex, Fold&& fold_func) throw(std::out_of_range) -> void
+	{
+		auto row = edge_weights(vertex);
+
+		// Local accumulator: <acc> might alias the weights, which would keep the loop scalar
+		W sum = acc;
+		for (auto w = row.first; w != row.second; w++)
+			sum += fold_func(*w);
+
+		acc = sum;
+	}
+
+	template <class T, class W>
+	template <class Map>
+	auto graph_csr<T, W>::weight_map(Map&& map_func) -> void
+	{
+		auto first = weights_.data(), last = weights_.data() + weights_.size();
+
+		for (auto w = first; w != last; w++)
+			map_func(*w);
+	}
+
+	template <class T, class W>
+	template <class Fold>
+	auto graph_csr<T, W>::weight_fold(W& acc, Fold&& fold_func) const -> void
+	{
+		auto first = weights_.data(), last = weights_.data() + weights_.size();
+
+		W sum = acc;
+		for (auto w = first; w != last; w++)
+			sum += fold_func(*w);
+
+		acc = sum;
+	}
+
+	template <class T, class W>
+	auto graph_csr<T, W>::edge_weights(index_type vertex) throw(std::out_of_range) -> std::pair<W*, W*>
+	{
+		_check(vertex);
+
+		return std::make_pair(weights_.data() + offsets_[vertex], weights_.data() + offsets_[vertex + 1]);
+	}
+
+	template <class T, class W>
+	auto graph_csr<T, W>::edge_weights(index_type vertex) const throw(std::out_of_range) -> std::pair<const W*, const W*>
+	{
+		_check(vertex);
+
+		return std::make_pair(weights_.data() + offsets_[vertex], weights_.data() + offsets_[vertex + 1]);
+	}
+
+	template <class T, class W>
+	auto graph_csr<T, W>::edge_targets(index_type vertex) const throw(std::out_of_range) -> std::pair<const index_type*, const index_type*>
+	{
+		_check(vertex);
+
+		return std::make_pair(targets_.data() + offsets_[vertex], targets_.data() + offsets_[vertex + 1]);
+	}
+
+	template <class T, class W>
+	auto graph_csr<T, W>::edge_size(index_type vertex) const throw(std::out_of_range) -> size_t
+	{
+		_check(vertex);
+
+		return offsets_[vertex + 1] - offsets_[vertex];
+	}
+
+	template <class T, class W>
+	auto graph_csr<T, W>::vertex_data(index_type vertex) const throw(std::out_of_range) -> const T&
+	{
+		_check(vertex);
+
+		return vertices_[vertex];
+	}
+
+	template <class T, class W>
+	auto graph_csr<T, W>::find_vertex(const T& data_to_find) const -> index_type
+	{
+		for (size_t v = 0; v < size(); v++)
+			if (vertices_[v] == data_to_find)
+				return static_cast<index_type>(v);
+
+		return npos;
+	}
+}
\ No newline at end of file
@@ -3,16 +3,16 @@
 // std::bidirectional_iterator_tag, std::forward_iterator_tag, std::iterator
 #include <iterator>
 
-// std::out_of_range, std::length_error
+// std::out_of_range, std::length_error, std::logic_error
 #include <stdexcept>
 
 // std::cout, std::endl, std::ostream
 #include <iostream>
 
-// std::move, std::swap, std::ptrdiff_t
+// std::move, std::swap, std::pair, std::ptrdiff_t
 #include <utility>
 
-// std::is_same, std::enable_if
+// std::is_same, std::enable_if, std::alignment_of, std::is_trivially_destructible, std::conditional
 #include <type_traits>
 
 // std::initializer_list
@@ -27,8 +27,53 @@
 // std::tuple, std::get
 #include <tuple>
 
+// placement new, ::operator new, ::operator delete
+#include <new>
+
+// std::vector
+#include <vector>
+
+// std::unordered_map
+#include <unordered_map>
+
+// std::string, std::to_string
+#include <string>
+
+// std::reverse, std::min, std::sort, std::inplace_merge, std::rotate
+#include <algorithm>
+
+// std::unique_ptr
+#include <memory>
+
+// std::ofstream
+#include <fstream>
+
+// std::memcpy, std::memcmp
+#include <cstring>
+
 #include "hadt_common.hpp"
 
+// hadt::io::chunk_reader, hadt::io::parse_field, hadt::io::edge_list_header
+#include "./hadt_edge_list_io.hpp"
+
+// hadt::graph_csr
+#include "./hadt_graph_csr.hpp"
+
+// hadt::reachability_index
+#include "./hadt_reachability.hpp"
+
+// hadt::dary_heap
+#include "./hadt_dary_heap.hpp"
+
+// hadt::disjoint_sets
+#include "./hadt_disjoint_sets.hpp"
+
+// hadt::vertex_property
+#include "./hadt_vertex_property.hpp"
+
+// hadt::parallel_for, hadt::parallel_parts
+#include "./hadt_parallel.hpp"
+
 
 namespace hadt {
 
@@ -119,7 +164,10 @@ namespace hadt {
 			typename hadt::vertex_iterator_base<T, W, IsConst>::iterator_value_type_ptr ptr_;
 		};
 
-		/* Internal class : [Const] Edge Iterator */
+		/* Internal class : [Const] Edge Iterator
+		 * Walks the chain of edge nodes and then the vertex' edge arrays (see enable_edge_arrays()).
+		 * Iterators without arrays to reach are plain chain walks
+		 */
 
 		template <bool IsConst = false>
 		class list_edge_iterator : public std::iterator <std::forward_iterator_tag, W>
@@ -135,27 +183,53 @@ namespace hadt {
 
 			typedef std::forward_iterator_tag iterator_category;
 
-			list_edge_iterator() : ptr_{ nullptr } {};
-			explicit list_edge_iterator(EdgeNode<T, W>* ptr) : ptr_(ptr) {};
+			// EdgeArrays * / const EdgeArrays *
+			typedef typename std::conditional<IsConst, const EdgeArrays<T, W>*, EdgeArrays<T, W>*>::type arrays_pointer;
+
+			list_edge_iterator() : ptr_{ nullptr }, arrays_{ nullptr }, pos_{ 0 } {};
+			explicit list_edge_iterator(EdgeNode<T, W>* ptr) : ptr_(ptr), arrays_{ nullptr }, pos_{ 0 } {};
+			// Chain from <ptr> (nullptr if it's empty), then the vertex' edge <arrays>
+			list_edge_iterator(EdgeNode<T, W>* ptr, arrays_pointer arrays) : ptr_(ptr), arrays_(arrays), pos_{ 0 } {};
 
-			list_edge_iterator(const list_edge_iterator<IsConst>& it) : ptr_(it.ptr_) {};
-			list_edge_iterator(const list_edge_iterator<IsConst>&& it) : ptr_(std::move(it.ptr_)) {};
+			list_edge_iterator(const list_edge_iterator<IsConst>& it) : ptr_(it.ptr_), arrays_(it.arrays_), pos_(it.pos_) {};
+			list_edge_iterator(const list_edge_iterator<IsConst>&& it) : ptr_(std::move(it.ptr_)), arrays_(std::move(it.arrays_)), pos_(it.pos_) {};
 
 			list_edge_iterator<IsConst>& operator=(const list_edge_iterator<IsConst>& it) = delete;
 			list_edge_iterator<IsConst>& operator=(const list_edge_iterator<IsConst>&& it) = delete;
 
-			bool operator==(const list_edge_iterator<IsConst>& other) { return ptr_ == other.ptr_; }
-			bool operator!=(const list_edge_iterator<IsConst>& other) { return ptr_ != other.ptr_; }
+			// Chain positions compare by node; every finished walk is equal to edge_end()
+			bool operator==(const list_edge_iterator<IsConst>& other)
+			{
+				if (ptr_ != nullptr && other.ptr_ != nullptr)
+					return ptr_ == other.ptr_;
+
+				return _at_end() ? other._at_end() : (ptr_ == other.ptr_ && arrays_ == other.arrays_ && pos_ == other.pos_);
+			}
+			bool operator!=(const list_edge_iterator<IsConst>& other) { return !(*this == other); }
 
-			reference operator*() const { return ptr_->weight; }
-			pointer operator->() const { return &(ptr_->weight); } // { return &(**this) }
+			reference operator*() const { return ptr_ != nullptr ? ptr_->weight : arrays_->weights[pos_]; }
+			pointer operator->() const { return &**this; }
 
-			auto get() const -> reference { return &(ptr_->weight); }
+			auto get() const -> reference { return **this; }
+			// Edge node (nullptr for edges kept in arrays)
 			auto get_node() const -> EdgeNode<T, W>* { return ptr_; }
+			// Vertex the edge leads to
+			auto target() const -> VertexNode<T, W>* { return ptr_ != nullptr ? ptr_->connects_to : arrays_->targets[pos_]; }
 
 			auto operator++() -> list_edge_iterator<IsConst>&
 			{
+				if (ptr_ == nullptr)
+				{
+					pos_++;
+					return *this;
+				}
+
 				ptr_ = ptr_->next;
+
+				// Past the chain's sentinel (the only edge without <next>) come the arrays
+				if (arrays_ != nullptr && ptr_->next == nullptr)
+					ptr_ = nullptr;
+
 				return *this;
 			}
 
@@ -168,14 +242,197 @@ namespace hadt {
 
 		private:
 
+			auto _at_end() const -> bool
+			{
+				return ptr_ != nullptr ? ptr_->next == nullptr : (arrays_ == nullptr || pos_ == arrays_->targets.size());
+			}
+
 			// HNode * / const HNode *
 			typename hadt::edge_iterator_base<T, W, IsConst>::iterator_value_type_ptr ptr_;
+			// Edge arrays of the vertex (nullptr for plain chain walks) and position in them
+			arrays_pointer arrays_;
+			size_t pos_;
+		};
+
+		/* Internal class : [Const] Lazy Traversal Range (BFS or DFS) */
+
+		// Hand-written state machine: next vertex is found (and previous one expanded) only on ++,
+		// so leaving a range-for early touches no more of the graph than has been visited
+		template <bool IsDepth, bool IsConst = false>
+		class traversal_range
+		{
+		public:
+
+			class iterator : public std::iterator <std::input_iterator_tag, T>
+			{
+			public:
+
+				typedef T value_type;
+				// T& / const T&
+				typedef typename hadt::vertex_iterator_base<T, W, IsConst>::iterator_reference reference;
+				// T* / const T*
+				typedef typename hadt::vertex_iterator_base<T, W, IsConst>::iterator_pointer pointer;
+				typedef std::ptrdiff_t difference_type;
+
+				typedef std::input_iterator_tag iterator_category;
+
+				iterator() : range_{ nullptr } {};
+				explicit iterator(traversal_range *range) : range_(range) {};
+
+				// All exhausted iterators are equal
+				bool operator==(const iterator& other) const
+				{
+					return _at_end() == other._at_end() && (_at_end() || range_ == other.range_);
+				}
+				bool operator!=(const iterator& other) const { return !(*this == other); }
+
+				reference operator*() const { return range_->current->data; }
+				pointer operator->() const { return &(range_->current->data); }
+
+				auto get_node() const -> typename hadt::vertex_iterator_base<T, W, IsConst>::iterator_value_type_ptr { return range_->current; }
+
+				auto operator++() -> iterator&
+				{
+					range_->_advance();
+					return *this;
+				}
+
+			private:
+
+				auto _at_end() const -> bool { return range_ == nullptr || range_->current == nullptr; }
+
+				traversal_range *range_;
+			};
+
+			traversal_range(const graph_list* graph, VertexNode<T, W>* start)
+				: graph_(graph), current{ nullptr }
+			{
+				marks.reset(graph->next_id);
+
+				if (start != nullptr)
+					pending.push_back(start);
+
+				_advance();
+			}
+
+			// copy ctor; copy assign; move assign
+			traversal_range(const traversal_range& range) = delete;
+			traversal_range& operator=(const traversal_range& range) = delete;
+			traversal_range& operator=(traversal_range&& range) = delete;
+
+			// move ctor
+			traversal_range(traversal_range&& range) :
+				graph_(range.graph_),
+				marks(std::move(range.marks)),
+				pending(std::move(range.pending)),
+				current(range.current)
+			{
+				range.current = nullptr;
+			};
+
+			auto begin() -> iterator { return iterator(this); }
+			auto end() -> iterator { return iterator(); }
+
+		private:
+
+			auto _advance() -> void
+			{
+				// Children of the vertex handed out last are expanded only now
+				if (current != nullptr)
+				{
+					auto mark = pending.size();
+
+					for (auto edge = current->edge_head; edge != graph_->edge_tail_junk; edge = edge->next)
+						if (!marks.is_marked(edge->connects_to->id))
+							pending.push_back(edge->connects_to);
+
+					for (auto to : graph_->_arrays_of(current).targets)
+						if (!marks.is_marked(to->id))
+							pending.push_back(to);
+
+					// Put childs in reverse order to visit them from left to right
+					if (IsDepth)
+						std::reverse(pending.begin() + mark, pending.end());
+				}
+
+				current = nullptr;
+				while (!pending.empty())
+				{
+					VertexNode<T, W>* node;
+
+					// Stack for DFS, queue for BFS
+					if (IsDepth)
+					{
+						node = pending.back();
+						pending.pop_back();
+					}
+					else
+					{
+						node = pending.front();
+						pending.pop_front();
+					}
+
+					if (marks.test_and_mark(node->id))
+					{
+						current = node;
+						break;
+					}
+				}
+			}
+
+			const graph_list *graph_;
+			visited_marks marks;
+			std::deque<VertexNode<T, W>*> pending;
+			VertexNode<T, W> *current;
 		};
 
 		VertexNode<T, W> *head, *tail;
 		VertexNode<T, W> *tail_junk;
 		EdgeNode<T, W> *edge_tail_junk;
 
+		// Contiguous blocks of vertices/edges built by compact()
+		VertexNode<T, W> *vertex_block;
+		size_t vertex_block_size;
+		EdgeNode<T, W> *edge_block;
+		size_t edge_block_size;
+
+		// Optional hash index: payload -> (first vertex with that payload, count of such vertices).
+		// The hasher is type-erased, so T has to be hashable only if the index is enabled
+		typedef std::unordered_map<T, std::pair<VertexNode<T, W>*, size_t>, std::function<size_t(const T&)>> vertex_index_type;
+
+		vertex_index_type vertex_index;
+		bool is_indexed;
+
+		// Incoming edges as (source, edge) by vertex id, kept only while <tracks_in_edges> is set.
+		// EdgeNode::in_slot is the position of an edge's entry
+		bool tracks_in_edges;
+		std::vector<std::vector<std::pair<VertexNode<T, W>*, EdgeNode<T, W>*>>> in_edge_lists;
+
+		// Dense 32-bit vertex ids: released ids are reused before <next_id> grows
+		std::vector<std::uint32_t> free_ids;
+		std::uint32_t next_id;
+
+		// Columns added by add_vertex_property(), kept in step with vertex ids
+		std::vector<std::unique_ptr<vertex_property_base>> vertex_properties;
+
+		// Visited state of traversals that don't get one from outside
+		visited_marks traversal_marks;
+
+		// Arena mode: nodes are bump-allocated from large blocks that are only released all at once
+		bool uses_arena;
+		size_t arena_block_size;
+		std::vector<char*> arena_blocks;
+		char *arena_pos;
+		char *arena_end;
+
+		// Edge arrays mode: new edges go to the arrays of their source instead of the chain.
+		// Arrays exist only in this mode, one slot per vertex id; a deque keeps them in place
+		// (and edge iterators valid) as ids are added. Like the nodes, they stay writable
+		// through a const graph, hence mutable; <no_edge_arrays> stands in outside of the mode
+		bool uses_edge_arrays;
+		mutable std::deque<EdgeArrays<T, W>> edge_arrays;
+		mutable EdgeArrays<T, W> no_edge_arrays;
+
 		size_t size_;
 
 	public:
@@ -187,6 +444,14 @@ namespace hadt {
 		typedef list_edge_iterator<false> edge_iterator;
 		typedef list_edge_iterator<true> const_edge_iterator;
 
+		typedef traversal_range<false> bfs_range_type;
+		typedef traversal_range<false, true> const_bfs_range_type;
+		typedef traversal_range<true> dfs_range_type;
+		typedef traversal_range<true, true> const_dfs_range_type;
+
+		// (weight, from, to) edge, the node counterpart of make_edge()
+		typedef std::tuple<W, VertexNode<T, W>*, VertexNode<T, W>*> weighted_edge_type;
+
 		graph_list();
 		~graph_list() throw();
 
@@ -204,23 +469,46 @@ namespace hadt {
 		const_vertex_iterator cbegin() const { return const_vertex_iterator(head); }
 		const_vertex_iterator cend() const { return const_vertex_iterator(tail_junk); }
 
-		edge_iterator edge_begin(VertexNode<T, W>* node) const { return edge_iterator(node->edge_head); }
+		edge_iterator edge_begin(VertexNode<T, W>* node) const
+		{
+			auto& arrays = _arrays_of(node);
+			return arrays.targets.empty() ? edge_iterator(node->edge_head) :
+				edge_iterator(node->edge_head == edge_tail_junk ? nullptr : node->edge_head, &arrays);
+		}
 		edge_iterator edge_end() const { return edge_iterator(edge_tail_junk); }
 
-		const_edge_iterator edge_cbegin(VertexNode<T, W>* node) const { return const_edge_iterator(node->edge_head); }
+		const_edge_iterator edge_cbegin(VertexNode<T, W>* node) const
+		{
+			const auto& arrays = _arrays_of(node);
+			return arrays.targets.empty() ? const_edge_iterator(node->edge_head) :
+				const_edge_iterator(node->edge_head == edge_tail_junk ? nullptr : node->edge_head, &arrays);
+		}
 		const_edge_iterator edge_cend() const { return const_edge_iterator(edge_tail_junk); }
 
-		// Add nodes
-		auto add_vertex(T vertex_data) -> VertexNode<T, W>*;
-		auto add_vertices(std::initializer_list<T> vertices) -> void;
+		// Add nodes (std::length_error once all UINT32_MAX vertex ids are taken)
+		auto add_vertex(T vertex_data) throw(std::length_error) -> VertexNode<T, W>*;
+		auto add_vertices(std::initializer_list<T> vertices) throw(std::length_error) -> void;
 
+		// O(1)
 		auto add_edge(W weight, VertexNode<T, W>* const from, VertexNode<T, W>* const to) -> void;
 		auto add_edge(W weight, T from, T to) throw(std::invalid_argument) -> void;
 		auto add_edges(std::initializer_list<std::tuple<W, T, T>> edges) throw(std::invalid_argument) -> void;
+
+		// O(k) | appends a batch of (weight, target) edges to the given vertex at once
+		auto add_edges_from(VertexNode<T, W>* const from,
+			std::initializer_list<std::pair<W, VertexNode<T, W>*>> neighbors) throw(std::invalid_argument) -> void;
+
+		template <class Iter, class Enable = typename std::enable_if<
+			(std::is_same<typename std::iterator_traits<Iter>::iterator_category, std::forward_iterator_tag>::value ||
+			std::is_same<typename std::iterator_traits<Iter>::iterator_category, std::bidirectional_iterator_tag>::value ||
+			std::is_same<typename std::iterator_traits<Iter>::iterator_category, std::random_access_iterator_tag>::value) &&
+			std::is_same<typename std::iterator_traits<Iter>::value_type, std::pair<W, VertexNode<T, W>*>>::value
+		>::type>
+		auto add_edges_from(VertexNode<T, W>* const from, const Iter& _begin, const Iter& _end) throw(std::invalid_argument) -> void;
 		
 		// Remove nodes
-		// O(V * E)
-		auto remove_vertex(VertexNode<T, W>* node) throw(std::invalid_argument) -> void;
+		// O(V + E) | O(degree) if in-edges are tracked
+		auto remove_vertex(VertexNode<T, W>* node) throw(std::invalid_argument, std::logic_error) -> void;
 		// O(E)
 		auto remove_egde(VertexNode<T, W>* from, VertexNode<T, W>* to) throw(std::invalid_argument) -> void;
 
@@ -240,6 +528,11 @@ namespace hadt {
 		auto bfs_vertex_map(std::function<void(T&)> map_func) -> void; // Breadth-First Search
 		auto dfs_vertex_map(std::function<void(T&)> map_func) -> void; // Depth-First-Search
 
+		// Read-only traversals keeping their visited state in <marks>: any number of them
+		// may run concurrently as long as each has its own marks and the graph isn't modified
+		auto bfs_vertex_map(std::function<void(const T&)> visit_func, visited_marks& marks) const -> void;
+		auto dfs_vertex_map(std::function<void(const T&)> visit_func, visited_marks& marks) const -> void;
+
 		// Functional Programming (FP) Routines
 
 		// Apply <map> function to all vertices
@@ -257,16 +550,88 @@ namespace hadt {
 		template <class Res> 
 		auto edge_fold(W& acc, const T& data_to_find, std::function<Res(W)> fold_func) throw(std::invalid_argument) -> void;
 
+		// Same routines for any callable: it is invoked directly (and can be inlined)
+		// instead of through std::function. Picked for lambdas unless <Res> is given explicitly
+		template <class Visit> auto bfs_vertex_map(Visit&& map_func) -> void;
+		template <class Visit> auto dfs_vertex_map(Visit&& map_func) -> void;
+		template <class Visit> auto bfs_vertex_map(Visit&& visit_func, visited_marks& marks) const -> void;
+		template <class Visit> auto dfs_vertex_map(Visit&& visit_func, visited_marks& marks) const -> void;
+
+		// Lazy traversals from <start> (the root if it's null): vertices are produced on demand,
+		// so a range-for may stop at the first match. The graph must not change while a range is in use
+		auto bfs_range(VertexNode<T, W>* start = nullptr) -> bfs_range_type;
+		auto bfs_range(VertexNode<T, W>* start = nullptr) const -> const_bfs_range_type;
+		auto bfs_range(const T& start) throw(std::invalid_argument) -> bfs_range_type;
+		auto bfs_range(const T& start) const throw(std::invalid_argument) -> const_bfs_range_type;
+
+		auto dfs_range(VertexNode<T, W>* start = nullptr) -> dfs_range_type;
+		auto dfs_range(VertexNode<T, W>* start = nullptr) const -> const_dfs_range_type;
+		auto dfs_range(const T& start) throw(std::invalid_argument) -> dfs_range_type;
+		auto dfs_range(const T& start) const throw(std::invalid_argument) -> const_dfs_range_type;
+
+		template <class Map> auto vertex_map(Map&& map_func) -> void;
+		template <class Fold> auto vertex_fold(T& acc, Fold&& fold_func) -> void;
+
+		// O(V / threads) after an O(V) walk that splits vertices between <threads> threads (0 - one per core).
+		// Callables run concurrently: they may only touch their own vertex and must not throw
+		template <class Map> auto parallel_vertex_map(Map&& map_func, unsigned threads = 0) -> void;
+		// Every thread folds its share into a copy of <init> with acc = <fold_func>(acc, vertex);
+		// partial results are merged in vertex order with acc = <combine_func>(acc, partial),
+		// so <combine_func> has to be associative and <init> neutral to it
+		template <class Acc, class Fold, class Combine>
+		auto parallel_vertex_fold(Acc init, Fold&& fold_func, Combine&& combine_func, unsigned threads = 0) const -> Acc;
+
+		template <class Map>
+		auto edge_map(VertexNode<T, W>* node, Map&& map_func) throw(std::invalid_argument) -> void;
+		template <class Map>
+		auto edge_map(const T& data_to_find, Map&& map_func) throw(std::invalid_argument) -> void;
+
+		template <class Fold>
+		auto edge_fold(W& acc, VertexNode<T, W>* node, Fold&& fold_func) throw(std::invalid_argument) -> void;
+		template <class Fold>
+		auto edge_fold(W& acc, const T& data_to_find, Fold&& fold_func) throw(std::invalid_argument) -> void;
+
 		// Search paths (from root to the bottom) using DFS traversal and 
 		// applying a map/fold function to each found path
 		template <class Cont, class Oper>
 		auto dfs_path_fold(Cont& container, std::function<typename Cont::value_type(T)> transform_func) -> void;
+		template <class Cont, class Oper>
+		auto dfs_path_fold(Cont& container, std::function<typename Cont::value_type(T)> transform_func, visited_marks& marks) const -> void;
+
+		// Same, folding with any callable <fold_func>(acc, transformed value) instead of a default-constructed Oper.
+		// Every DFS frame keeps its prefix value and edge cursor, so each step is O(1) folds/edge visits
+		template <class Cont, class Transform, class Fold>
+		auto dfs_path_fold_with(Cont& container, Transform transform_func, Fold fold_func) -> void;
+		template <class Cont, class Transform, class Fold>
+		auto dfs_path_fold_with(Cont& container, Transform transform_func, Fold fold_func, visited_marks& marks) const -> void;
+
+		// Dependency ordering (an edge from -> to means <from> goes before <to>)
+
+		// O(V + E) | Kahn's algorithm: every vertex comes after all of its predecessors
+		auto topological_sort() const throw(std::logic_error) -> std::vector<VertexNode<T, W>*>;
+		// O(V + E) | vertices grouped by the length of the longest path reaching them:
+		// there are no edges inside a level, so each level can be processed concurrently
+		auto topological_levels() const throw(std::logic_error) -> std::vector<std::vector<VertexNode<T, W>*>>;
+		// O(V + E) | true if the graph has no directed cycle
+		auto is_acyclic() const -> bool;
+		// O(V + E) | some directed cycle v0 -> v1 -> ... -> vk -> v0 as [v0, ..., vk]; empty if there is none
+		auto find_cycle() const -> std::vector<VertexNode<T, W>*>;
 
 		/* Service functions */
 
 		// O(1) | returns vertex node count
 		inline auto size() const -> size_t { return size_; };
-		// O(n) | returns giveb vertex's edge count
+		// O(1) | returns upper bound of dense vertex ids (VertexNode::id)
+		inline auto id_bound() const -> size_t { return next_id; };
+		// O(id_bound) | adds a column with a slot for every vertex id, which algorithms can index
+		// by VertexNode::id instead of hashing vertex nodes. Present vertices and all vertices added
+		// later start with <initial>; the column lives until it's removed or the graph is destroyed
+		template <class U>
+		auto add_vertex_property(const U& initial = U()) -> vertex_property<U>&;
+		auto remove_vertex_property(const vertex_property_base& property) throw(std::invalid_argument) -> void;
+		inline auto vertex_property_count() const -> size_t { return vertex_properties.size(); };
+
+		// O(1) | returns given vertex's edge count
 		auto edge_size(const VertexNode<T, W>* const node) const throw(std::invalid_argument) -> size_t;
 		auto edge_size(const T& vertex_data) const throw(std::invalid_argument) -> size_t;
 		
@@ -275,10 +640,30 @@ namespace hadt {
 		// Returns VertexNode's data
 		auto vertex_data(const VertexNode<T, W>* const node) const throw(std::invalid_argument) -> T;
 
-		// O(n) | clears <is_visited> flag
+		// O(n) | clears <is_visited> flag (traversals keep their state in visited_marks)
 		auto clear_visited() -> void;
 
-		// TODO: add IsReachable function
+		// O(V + E) | one-off query: searches from <from> until <to> shows up
+		auto is_reachable(const VertexNode<T, W>* from, const VertexNode<T, W>* to) const throw(std::invalid_argument) -> bool;
+		auto is_reachable(const T& from, const T& to) const throw(std::invalid_argument) -> bool;
+
+		// O(V + E) | strongly connected components (iterative Tarjan), listed so that
+		// edges between components only lead to earlier ones (reverse topological order)
+		auto strongly_connected_components() const -> std::vector<std::vector<VertexNode<T, W>*>>;
+
+		// O(V + E log E + E' * C / 64) for C components, E' condensed edges | index for repeated queries
+		// (bit closure up to <closure_limit> components, DFS interval labels and a label-pruned search beyond it)
+		auto reachability(size_t closure_limit = reachability_index::default_closure_limit) const -> reachability_index;
+
+		// Minimum spanning forest: edges are taken as undirected (self-loops are ignored)
+		// and every tree edge is returned as (weight, from, to)
+
+		// O(E log E) | Kruskal: edges are sorted in up to <threads> concurrent runs (0 - one per core),
+		// the result comes in ascending weight order
+		auto kruskal_msf(unsigned threads = 0) const -> std::vector<weighted_edge_type>;
+		// O(E log V) | Prim over an indexed d-ary heap, growing one tree after another in vertex order;
+		// <from> is the end that was already in the tree
+		auto prim_msf() const -> std::vector<weighted_edge_type>;
 
 		// Print functions
 		auto print_graph(std::ostream& stream = std::cout) -> std::ostream&;
@@ -287,6 +672,60 @@ namespace hadt {
 		// O(1) | returns initial vertex
 		auto root() const -> const VertexNode<T, W>* { return head; }
 
+		// O(V + E) | relinks all vertices and all edges into two contiguous blocks
+		// following the vertex order and the per-vertex edge order
+		auto compact() -> void;
+
+		// O(V + E) | builds an immutable CSR snapshot (vertex i is the i-th vertex of the list)
+		auto freeze() const -> graph_csr<T, W>;
+
+		// O(E) | streams "src dst [weight]" text lines (blank lines and '#'/'%' comments are skipped).
+		// Vertices are matched by payload through the hash index and created on first sight.
+		// Returns the number of loaded edges
+		auto load_edge_list(const std::string& path) throw(std::runtime_error, std::length_error) -> size_t;
+
+		// O(V + E) | appends a packed binary dump (see io::edge_list_header); returns the number of loaded edges
+		auto load_edge_list_binary(const std::string& path) throw(std::runtime_error, std::length_error) -> size_t;
+		// O(V + E) | writes the graph in the packed binary format (at most UINT32_MAX vertices)
+		auto save_edge_list_binary(const std::string& path) const throw(std::runtime_error, std::length_error) -> void;
+
+		// O(V) | builds a hash index on vertex payload; while enabled, value-keyed lookups
+		// (add_edge(W, T, T), add_edges, edge_map, edge_fold, edge_size) are O(1) on average.
+		// The index is keyed on payload values: the mutable vertex maps rebuild it when they're done,
+		// but after writing payloads any other way (iterators, ranges, nodes) it has to be rebuilt
+		// by calling enable_vertex_index() again (remove_vertex() throws std::logic_error on a stale entry)
+		template <class Hash = std::hash<T>>
+		auto enable_vertex_index(Hash hash = Hash()) -> void;
+		auto disable_vertex_index() -> void;
+		inline auto has_vertex_index() const -> bool { return is_indexed; };
+
+		// O(V + E) | starts maintaining per-vertex lists of incoming edges, which lets
+		// remove_vertex() visit only the actual neighbours instead of every vertex.
+		// The lists are held by the graph only while tracking is on
+		auto enable_in_edges() throw(std::logic_error) -> void;
+		auto disable_in_edges() -> void;
+		inline auto has_in_edges() const -> bool { return tracks_in_edges; };
+
+		// O(1) | arena mode: vertices and edges are bump-allocated from <block_size>-byte blocks
+		// (a batch of add_edges_from() lands in one block), removed nodes are only destroyed
+		// and clear() gives back whole blocks, without visiting any node if T and W are trivially
+		// destructible. Can only be switched on an empty graph
+		auto enable_arena(size_t block_size = size_t{ 1 } << 16) throw(std::logic_error) -> void;
+		auto disable_arena() throw(std::logic_error) -> void;
+		inline auto has_arena() const -> bool { return uses_arena; };
+
+		// O(V + E) | edge arrays mode: every vertex keeps its edge targets and weights in two parallel
+		// contiguous arrays instead of a chain of edge nodes, so edge_map() and edge_fold() run as plain
+		// loops over the weights. Edge iterators walk the arrays too, but their get_node() is null there
+		// (target() works either way). The arrays are held by the graph only while the mode is on,
+		// disable_edge_arrays() gives them back. Can't be combined with in-edge tracking
+		auto enable_edge_arrays() throw(std::logic_error) -> void;
+		auto disable_edge_arrays() -> void;
+		inline auto has_edge_arrays() const -> bool { return uses_edge_arrays; };
+
+		// O(1) | returns given vertex's incoming edge count (in-edges have to be tracked)
+		auto in_edge_size(const VertexNode<T, W>* const node) const throw(std::invalid_argument, std::logic_error) -> size_t;
+
 		// Clear data
 		auto clear() throw() -> void;
 
@@ -294,10 +733,95 @@ namespace hadt {
 
 		// Find vertex (returns first found node with the given value to search)
 		auto find_vertex(const T& data_to_found) const->VertexNode<T, W>*;
+
+		// Release nodes (heap-allocated or living in a compacted block)
+		auto _delete_vertex(VertexNode<T, W>* node) throw() -> void;
+		auto _delete_edge(EdgeNode<T, W>* node) throw() -> void;
+		auto _release_blocks() throw() -> void;
+
+		// Node allocation (heap or arena)
+		auto _new_vertex(T vertex_data) -> VertexNode<T, W>*;
+		auto _new_edge(W weight, VertexNode<T, W>* to) -> EdgeNode<T, W>*;
+
+		// Arena maintenance: node sizes are rounded up to keep every node aligned
+		static auto _arena_round(size_t bytes) -> size_t;
+		auto _arena_reserve(size_t bytes) -> void;
+		auto _arena_alloc(size_t bytes) -> void*;
+		auto _release_arena() throw() -> void;
+
+		// Vertex index maintenance
+		auto _rebuild_vertex_index() -> void;
+		auto _unindex_vertex(const VertexNode<T, W>* node) throw(std::logic_error) -> void;
+
+		// Runs <func>, which may write payloads, and then brings the vertex index up to date
+		template <class Func> auto _map_payloads(Func&& func) -> void;
+
+		// Remove every <from> -> <to> edge
+		auto _remove_edges_to(VertexNode<T, W>* from, const VertexNode<T, W>* to) -> void;
+
+		// O(1) | edge arrays of <node> (empty ones outside of edge arrays mode)
+		inline auto _arrays_of(const VertexNode<T, W>* node) const -> EdgeArrays<T, W>&
+		{
+			return uses_edge_arrays ? edge_arrays[node->id] : no_edge_arrays;
+		}
+
+		// O(1) amortized | append an edge to <from>'s edge arrays
+		auto _push_edge(W weight, VertexNode<T, W>* from, VertexNode<T, W>* to) -> void;
+		// O(out-degree) | drop the <pos>-th edge of <from>'s edge arrays, keeping the order of the rest
+		auto _erase_array_edge(VertexNode<T, W>* from, size_t pos) -> void;
+
+		// Calls <func>(target, weight) for every edge of <node>: the chain first, then the edge arrays
+		template <class Func>
+		auto _for_each_edge(const VertexNode<T, W>* node, Func&& func) const -> void;
+
+		// O(1) | unlink <edge> from <from>'s edges and release it
+		auto _unlink_edge(VertexNode<T, W>* from, EdgeNode<T, W>* edge) -> void;
+
+		// O(1) | add / drop <edge>'s entry in its target's incoming edges
+		auto _track_in_edge(VertexNode<T, W>* from, EdgeNode<T, W>* edge) -> void;
+		auto _erase_in_edge(EdgeNode<T, W>* edge) -> void;
+
+		// Range start: <start> if given, otherwise the root (nullptr for an empty graph)
+		auto _range_start(VertexNode<T, W>* start) const -> VertexNode<T, W>*;
+		auto _range_start(const T& start) const throw(std::invalid_argument) -> VertexNode<T, W>*;
+
+		// Kahn's algorithm core: fills <order> and, if given, the longest-path <depth> of every id;
+		// false if a cycle left some vertices out
+		auto _kahn(std::vector<VertexNode<T, W>*>& order, std::vector<size_t>* depth) const -> bool;
+
+		// Iterative Tarjan: fills the component of every vertex id (npos for unused ids)
+		// in reverse topological order; returns the number of components
+		auto _tarjan(std::vector<reachability_index::index_type>& component) const -> size_t;
+
+		// Vertices in list order, for splitting them between threads
+		auto _vertex_nodes() const -> std::vector<VertexNode<T, W>*>;
+
+		// Sorts runs of <items> concurrently and merges them (plain std::sort for small inputs)
+		template <class Item, class Less>
+		static auto _parallel_sort(std::vector<Item>& items, Less less, unsigned threads) -> void;
+
+		// Traversal cores shared by the overloads with internal and external visited state
+		template <class Visit>
+		auto _bfs(Visit& visit, visited_marks& marks) const -> void;
+		template <class Visit>
+		auto _dfs(Visit& visit, visited_marks& marks) const -> void;
 	};
 
 	template <class T, class W>
-	graph_list<T, W>::graph_list()
+	graph_list<T, W>::graph_list() :
+		vertex_block{ nullptr },
+		vertex_block_size{ 0 },
+		edge_block{ nullptr },
+		edge_block_size{ 0 },
+		is_indexed{ false },
+		tracks_in_edges{ false },
+		next_id{ 0 },
+		uses_arena{ false },
+		arena_block_size{ 0 },
+		arena_pos{ nullptr },
+		arena_end{ nullptr },
+		uses_edge_arrays{ false },
+		size_{ 0 }
 	{ 
 		tail_junk = new VertexNode<T, W>(T{}, false, nullptr, nullptr);
 		head = tail = tail_junk;
@@ -327,394 +851,2121 @@ namespace hadt {
 	template <class T, class W>
 	auto graph_list<T, W>::bfs_vertex_map(std::function<void(T&)> map_func) -> void
 	{
-		using VNode = VertexNode<T, W>*;
-
-		// Breadth-First Traversal
-		clear_visited();
+		_map_payloads([&]() { _bfs(map_func, traversal_marks); });
+	}
 
-		VNode node;
-		std::deque<VNode> v_list;
+	template <class T, class W>
+	auto graph_list<T, W>::dfs_vertex_map(std::function<void(T&)> map_func) -> void
+	{
+		_map_payloads([&]() { _dfs(map_func, traversal_marks); });
+	}
 
-		// Push to Back ...
-		v_list.push_back(head);
-		while (!v_list.empty())
-		{
-			// ... and Pull from Front
-			node = v_list.front();
-			v_list.pop_front();
+	template <class T, class W>
+	auto graph_list<T, W>::bfs_vertex_map(std::function<void(const T&)> visit_func, visited_marks& marks) const -> void
+	{
+		_bfs(visit_func, marks);
+	}
 
-			if (node->is_visited)
-				continue;
+	template <class T, class W>
+	auto graph_list<T, W>::dfs_vertex_map(std::function<void(const T&)> visit_func, visited_marks& marks) const -> void
+	{
+		_dfs(visit_func, marks);
+	}
 
-			map_func(node->data);
-			node->is_visited = true;
-			for (auto it = edge_begin(node); it != edge_end(); it++)
-				v_list.push_back(it.get_node()->connects_to);
-		}
+	template <class T, class W>
+	template <class Visit>
+	auto graph_list<T, W>::bfs_vertex_map(Visit&& map_func) -> void
+	{
+		_map_payloads([&]() { _bfs(map_func, traversal_marks); });
 	}
 
 	template <class T, class W>
-	auto graph_list<T, W>::dfs_vertex_map(std::function<void(T&)> map_func) -> void
+	template <class Visit>
+	auto graph_list<T, W>::dfs_vertex_map(Visit&& map_func) -> void
 	{
-		using VNode = VertexNode<T, W>*;
+		_map_payloads([&]() { _dfs(map_func, traversal_marks); });
+	}
 
-		// Depth-First Traversal
-		clear_visited();
+	template <class T, class W>
+	template <class Visit>
+	auto graph_list<T, W>::bfs_vertex_map(Visit&& visit_func, visited_marks& marks) const -> void
+	{
+		// Payloads are only handed out as const
+		auto visit = [&visit_func](const T& data) { visit_func(data); };
+		_bfs(visit, marks);
+	}
 
-		VNode node;
-		std::deque<VNode> v_list;
-		std::vector<VNode> v_reverse;
+	template <class T, class W>
+	template <class Visit>
+	auto graph_list<T, W>::dfs_vertex_map(Visit&& visit_func, visited_marks& marks) const -> void
+	{
+		// Payloads are only handed out as const
+		auto visit = [&visit_func](const T& data) { visit_func(data); };
+		_dfs(visit, marks);
+	}
 
-		// Push to Back ...
-		v_list.push_back(head);
-		while (!v_list.empty())
-		{
-			// ... and Pull from Back
-			node = v_list.back();
-			v_list.pop_back();
+	template <class T, class W>
+	template <class Map>
+	auto graph_list<T, W>::vertex_map(Map&& map_func) -> void
+	{
+		_map_payloads([&]() {
+			for (auto node = head; node != tail_junk; node = node->next)
+				map_func(node->data);
+		});
+	}
 
-			if (node->is_visited)
-				continue;
+	template <class T, class W>
+	template <class Fold>
+	auto graph_list<T, W>::vertex_fold(T& acc, Fold&& fold_func) -> void
+	{
+		for (auto node = head; node != tail_junk; node = node->next)
+			acc += fold_func(node->data);
+	}
 
-			map_func(node->data);
-			node->is_visited = true;
-			
-			// In order to receive valid graph order (from left to right)
-			// we need to put new nodes in reverse order (due to internal order)
-			v_reverse.clear();
-			for (auto it = edge_begin(node); it != edge_end(); it++)
-				v_reverse.push_back(it.get_node()->connects_to);
-			
-			// Put childs in reverse order (in order that is opposite to what we have in VertexNode)
-			auto it = v_reverse.rbegin();
-			while (it != v_reverse.rend())
-				v_list.push_back(*it++);
-		}
+	template <class T, class W>
+	template <class Map>
+	auto graph_list<T, W>::parallel_vertex_map(Map&& map_func, unsigned threads) -> void
+	{
+		auto nodes = _vertex_nodes();
+
+		_map_payloads([&]() {
+			parallel_for(nodes.size(), threads, [&nodes, &map_func](size_t first, size_t last, unsigned) {
+				for (auto v = first; v < last; v++)
+					map_func(nodes[v]->data);
+			});
+		});
 	}
 
 	template <class T, class W>
-	auto graph_list<T, W>::vertex_map(std::function<void(T&)> map_func) -> void
+	template <class Acc, class Fold, class Combine>
+	auto graph_list<T, W>::parallel_vertex_fold(Acc init, Fold&& fold_func, Combine&& combine_func, unsigned threads) const -> Acc
 	{
-		for (auto it = begin(); it != end(); it++)
-			map_func(*it);
+		// Wrapped, so that bool partials don't end up sharing bytes in std::vector<bool>
+		struct partial { Acc value; };
+
+		auto nodes = _vertex_nodes();
+		std::vector<partial> partials(parallel_parts(nodes.size(), threads), partial{ init });
+
+		parallel_for(nodes.size(), threads, [&](size_t first, size_t last, unsigned part) {
+			// Local accumulator: neighbouring partials share cache lines
+			Acc acc = init;
+			for (auto v = first; v < last; v++)
+				acc = fold_func(acc, static_cast<const T&>(nodes[v]->data));
+
+			partials[part].value = std::move(acc);
+		});
+
+		auto result = std::move(partials[0].value);
+		for (size_t p = 1; p < partials.size(); p++)
+			result = combine_func(result, partials[p].value);
+
+		return result;
 	}
 
 	template <class T, class W>
-	template <class Res>
-	auto graph_list<T, W>::vertex_fold(T& acc, std::function<Res(T)> fold_func) -> void
+	auto graph_list<T, W>::_vertex_nodes() const -> std::vector<VertexNode<T, W>*>
 	{
-		for (auto it = begin(); it != end(); it++)
-			acc += fold_func(*it);
+		std::vector<VertexNode<T, W>*> nodes;
+		nodes.reserve(size_);
+
+		for (auto node = head; node != tail_junk; node = node->next)
+			nodes.push_back(node);
+
+		return nodes;
 	}
 
 	template <class T, class W>
-	auto graph_list<T, W>::edge_map(VertexNode<T, W>* node, std::function<void(W&)> map_func) throw(std::invalid_argument) -> void
+	template <class Map>
+	auto graph_list<T, W>::edge_map(VertexNode<T, W>* node, Map&& map_func) throw(std::invalid_argument) -> void
 	{
 		if (node == nullptr)
 			throw std::invalid_argument("Vertex node can't be null");
 
-		for (auto it = edge_begin(node); it != edge_end(); it++)
-			map_func(*it);
+		for (auto edge = node->edge_head; edge != edge_tail_junk; edge = edge->next)
+			map_func(edge->weight);
+
+		// Edge arrays: one pass over contiguous weights
+		auto& arrays = _arrays_of(node);
+		auto weights = arrays.weights.data();
+		for (size_t e = 0, count = arrays.weights.size(); e < count; e++)
+			map_func(weights[e]);
 	}
 
 	template <class T, class W>
-	auto graph_list<T, W>::edge_map(const T& data_to_find, std::function<void(W&)> map_func) throw(std::invalid_argument) -> void
+	template <class Map>
+	auto graph_list<T, W>::edge_map(const T& data_to_find, Map&& map_func) throw(std::invalid_argument) -> void
 	{
 		auto found = find_vertex(data_to_find);
 		if (found == nullptr)
 			throw std::invalid_argument("Can't find a vertex node with given value");
 
-		edge_map(found, map_func);
+		edge_map(found, std::forward<Map>(map_func));
 	}
 
 	template <class T, class W>
-	template <class Res>
-	auto graph_list<T, W>::edge_fold(W& acc, VertexNode<T, W>* node, std::function<Res(W)> fold_func) throw(std::invalid_argument) -> void
+	template <class Fold>
+	auto graph_list<T, W>::edge_fold(W& acc, VertexNode<T, W>* node, Fold&& fold_func) throw(std::invalid_argument) -> void
 	{
 		if (node == nullptr)
 			throw std::invalid_argument("Vertex node can't be null");
 
-		for (auto it = edge_begin(node); it != edge_end(); it++)
-			acc += fold_func(*it);
+		for (auto edge = node->edge_head; edge != edge_tail_junk; edge = edge->next)
+			acc += fold_func(edge->weight);
+
+		// Edge arrays: a local sum over contiguous weights, which the compiler can vectorize
+		// for numeric weights once <fold_func> is inlined
+		auto& arrays = _arrays_of(node);
+		auto weights = arrays.weights.data();
+		auto sum = acc;
+		for (size_t e = 0, count = arrays.weights.size(); e < count; e++)
+			sum += fold_func(weights[e]);
+
+		acc = sum;
 	}
 
 	template <class T, class W>
-	template <class Res>
-	auto graph_list<T, W>::edge_fold(W& acc, const T& data_to_find, std::function<Res(W)> fold_func) throw(std::invalid_argument) -> void
+	template <class Fold>
+	auto graph_list<T, W>::edge_fold(W& acc, const T& data_to_find, Fold&& fold_func) throw(std::invalid_argument) -> void
 	{
 		auto found = find_vertex(data_to_find);
 		if (found == nullptr)
 			throw std::invalid_argument("Can't find a vertex node with given value");
 
-		edge_fold(acc, found, fold_func);
+		edge_fold(acc, found, std::forward<Fold>(fold_func));
 	}
 
 	template <class T, class W>
-	auto edge_map(VertexNode<T, W>* node, std::function<void(W&)> map_func) -> void
+	auto graph_list<T, W>::_range_start(VertexNode<T, W>* start) const -> VertexNode<T, W>*
 	{
-		for (auto it = edge_begin(node); it != VertexNode<T, W>::edge_end(); it++)
-			map_func(*it);
+		if (start != nullptr)
+			return start;
+
+		return head == tail_junk ? nullptr : head;
 	}
 
 	template <class T, class W>
-	auto edge_map(const T& data_to_find, std::function<void(W&)> map_func) -> void
+	auto graph_list<T, W>::_range_start(const T& start) const throw(std::invalid_argument) -> VertexNode<T, W>*
 	{
-		auto found = find_vertex(data_to_find);
+		auto found = find_vertex(start);
 		if (found == nullptr)
 			throw std::invalid_argument("Can't find a vertex node with given value");
 
-		for (auto it = edge_begin(found); it != VertexNode<T, W>::edge_end(); it++)
-			map_func(*it);
+		return found;
 	}
 
 	template <class T, class W>
-	template <class Cont, class Oper>
-	auto graph_list<T, W>::dfs_path_fold(Cont& container, std::function<typename Cont::value_type(T)> transform_func) -> void
+	auto graph_list<T, W>::bfs_range(VertexNode<T, W>* start) -> bfs_range_type
 	{
-		using ContVal = typename Cont::value_type;
-		using VNode = VertexNode<T, W>*;
+		return bfs_range_type(this, _range_start(start));
+	}
 
-		// Depth-First Traversal
-		clear_visited();
+	template <class T, class W>
+	auto graph_list<T, W>::bfs_range(VertexNode<T, W>* start) const -> const_bfs_range_type
+	{
+		return const_bfs_range_type(this, _range_start(start));
+	}
 
-		Oper operation;
+	template <class T, class W>
+	auto graph_list<T, W>::bfs_range(const T& start) throw(std::invalid_argument) -> bfs_range_type
+	{
+		return bfs_range_type(this, _range_start(start));
+	}
 
-		// need 'typename' before 'Cont:: value_type' because 'Cont' is a dependent scope
-		ContVal acc_value{};
-		
-		VNode temp{};
-		std::deque<VNode> v_list;
+	template <class T, class W>
+	auto graph_list<T, W>::bfs_range(const T& start) const throw(std::invalid_argument) -> const_bfs_range_type
+	{
+		return const_bfs_range_type(this, _range_start(start));
+	}
 
-		v_list.push_back(head);
-		while (!v_list.empty())
-		{
-			temp = v_list.back();
-			temp->is_visited = true;
+	template <class T, class W>
+	auto graph_list<T, W>::dfs_range(VertexNode<T, W>* start) -> dfs_range_type
+	{
+		return dfs_range_type(this, _range_start(start));
+	}
 
-			if (temp->edge_head == edge_tail_junk)
-			{
-				// Store the given path's value
-				for (auto it = v_list.begin(); it != v_list.end(); it++)
-					acc_value = operation(acc_value, transform_func((*it)->data));
+	template <class T, class W>
+	auto graph_list<T, W>::dfs_range(VertexNode<T, W>* start) const -> const_dfs_range_type
+	{
+		return const_dfs_range_type(this, _range_start(start));
+	}
 
-				container.push_back(acc_value);
-				acc_value = ContVal{};
-				v_list.pop_back();
-			}
+	template <class T, class W>
+	auto graph_list<T, W>::dfs_range(const T& start) throw(std::invalid_argument) -> dfs_range_type
+	{
+		return dfs_range_type(this, _range_start(start));
+	}
+
+	template <class T, class W>
+	auto graph_list<T, W>::dfs_range(const T& start) const throw(std::invalid_argument) -> const_dfs_range_type
+	{
+		return const_dfs_range_type(this, _range_start(start));
+	}
+
+	template <class T, class W>
+	template <class Visit>
+	auto graph_list<T, W>::_bfs(Visit& visit, visited_marks& marks) const -> void
+	{
+		using VNode = VertexNode<T, W>*;
+
+		if (head == tail_junk)
+			return;
+
+		// Breadth-First Traversal
+		marks.reset(next_id);
+
+		VNode node;
+		std::deque<VNode> v_list;
+
+		// Push to Back ...
+		v_list.push_back(head);
+		while (!v_list.empty())
+		{
+			// ... and Pull from Front
+			node = v_list.front();
+			v_list.pop_front();
+
+			if (!marks.test_and_mark(node->id))
+				continue;
+
+			visit(node->data);
+			for (auto edge = node->edge_head; edge != edge_tail_junk; edge = edge->next)
+			{
+				// Targets are read only for their id, which is the likely miss of this loop:
+				// the next edge's target is requested before this one is tested, so the two misses
+				// overlap (the sentinel's target is null, and a null hint is ignored)
+				prefetch(edge->next->connects_to);
+
+				if (!marks.is_marked(edge->connects_to->id))
+					v_list.push_back(edge->connects_to);
+			}
+
+			// Array targets are all known up front
+			auto& arrays = _arrays_of(node);
+			auto targets = arrays.targets.data();
+			for (size_t e = 0, count = arrays.targets.size(); e < count; e++)
+			{
+				if (e + 1 < count)
+					prefetch(targets[e + 1]);
+
+				if (!marks.is_marked(targets[e]->id))
+					v_list.push_back(targets[e]);
+			}
+		}
+	}
+
+	template <class T, class W>
+	template <class Visit>
+	auto graph_list<T, W>::_dfs(Visit& visit, visited_marks& marks) const -> void
+	{
+		using VNode = VertexNode<T, W>*;
+
+		if (head == tail_junk)
+			return;
+
+		// Depth-First Traversal
+		marks.reset(next_id);
+
+		VNode node;
+		std::deque<VNode> v_list;
+		std::vector<VNode> v_reverse;
+
+		// Push to Back ...
+		v_list.push_back(head);
+		while (!v_list.empty())
+		{
+			// ... and Pull from Back
+			node = v_list.back();
+			v_list.pop_back();
+
+			if (!marks.test_and_mark(node->id))
+				continue;
+
+			visit(node->data);
+			
+			// In order to receive valid graph order (from left to right)
+			// we need to put new nodes in reverse order (due to internal order)
+			v_reverse.clear();
+			_for_each_edge(node, [&v_reverse](VNode to, const W&) { v_reverse.push_back(to); });
+			
+			// Put childs in reverse order (in order that is opposite to what we have in VertexNode)
+			auto it = v_reverse.rbegin();
+			while (it != v_reverse.rend())
+				v_list.push_back(*it++);
+		}
+	}
+
+	template <class T, class W>
+	auto graph_list<T, W>::vertex_map(std::function<void(T&)> map_func) -> void
+	{
+		_map_payloads([&]() {
+			for (auto it = begin(); it != end(); it++)
+				map_func(*it);
+		});
+	}
+
+	template <class T, class W>
+	template <class Res>
+	auto graph_list<T, W>::vertex_fold(T& acc, std::function<Res(T)> fold_func) -> void
+	{
+		for (auto it = begin(); it != end(); it++)
+			acc += fold_func(*it);
+	}
+
+	template <class T, class W>
+	auto graph_list<T, W>::edge_map(VertexNode<T, W>* node, std::function<void(W&)> map_func) throw(std::invalid_argument) -> void
+	{
+		if (node == nullptr)
+			throw std::invalid_argument("Vertex node can't be null");
+
+		for (auto it = edge_begin(node); it != edge_end(); it++)
+			map_func(*it);
+	}
+
+	template <class T, class W>
+	auto graph_list<T, W>::edge_map(const T& data_to_find, std::function<void(W&)> map_func) throw(std::invalid_argument) -> void
+	{
+		auto found = find_vertex(data_to_find);
+		if (found == nullptr)
+			throw std::invalid_argument("Can't find a vertex node with given value");
+
+		edge_map(found, map_func);
+	}
+
+	template <class T, class W>
+	template <class Res>
+	auto graph_list<T, W>::edge_fold(W& acc, VertexNode<T, W>* node, std::function<Res(W)> fold_func) throw(std::invalid_argument) -> void
+	{
+		if (node == nullptr)
+			throw std::invalid_argument("Vertex node can't be null");
+
+		for (auto it = edge_begin(node); it != edge_end(); it++)
+			acc += fold_func(*it);
+	}
+
+	template <class T, class W>
+	template <class Res>
+	auto graph_list<T, W>::edge_fold(W& acc, const T& data_to_find, std::function<Res(W)> fold_func) throw(std::invalid_argument) -> void
+	{
+		auto found = find_vertex(data_to_find);
+		if (found == nullptr)
+			throw std::invalid_argument("Can't find a vertex node with given value");
+
+		edge_fold(acc, found, fold_func);
+	}
+
+	template <class T, class W>
+	auto edge_map(VertexNode<T, W>* node, std::function<void(W&)> map_func) -> void
+	{
+		for (auto it = edge_begin(node); it != VertexNode<T, W>::edge_end(); it++)
+			map_func(*it);
+	}
+
+	template <class T, class W>
+	auto edge_map(const T& data_to_find, std::function<void(W&)> map_func) -> void
+	{
+		auto found = find_vertex(data_to_find);
+		if (found == nullptr)
+			throw std::invalid_argument("Can't find a vertex node with given value");
+
+		for (auto it = edge_begin(found); it != VertexNode<T, W>::edge_end(); it++)
+			map_func(*it);
+	}
+
+	template <class T, class W>
+	template <class Cont, class Oper>
+	auto graph_list<T, W>::dfs_path_fold(Cont& container, std::function<typename Cont::value_type(T)> transform_func) -> void
+	{
+		dfs_path_fold<Cont, Oper>(container, transform_func, traversal_marks);
+	}
+
+	template <class T, class W>
+	template <class Cont, class Oper>
+	auto graph_list<T, W>::dfs_path_fold(Cont& container, std::function<typename Cont::value_type(T)> transform_func, visited_marks& marks) const -> void
+	{
+		dfs_path_fold_with(container, transform_func, Oper(), marks);
+	}
+
+	template <class T, class W>
+	template <class Cont, class Transform, class Fold>
+	auto graph_list<T, W>::dfs_path_fold_with(Cont& container, Transform transform_func, Fold fold_func) -> void
+	{
+		dfs_path_fold_with(container, transform_func, fold_func, traversal_marks);
+	}
+
+	template <class T, class W>
+	template <class Cont, class Transform, class Fold>
+	auto graph_list<T, W>::dfs_path_fold_with(Cont& container, Transform transform_func, Fold fold_func, visited_marks& marks) const -> void
+	{
+		// need 'typename' before 'Cont:: value_type' because 'Cont' is a dependent scope
+		using ContVal = typename Cont::value_type;
+		using VNode = VertexNode<T, W>*;
+
+		// Path prefix ending at <node>: its folded value and the next edge to try
+		struct frame
+		{
+			VNode node;
+			edge_iterator cursor;
+			ContVal acc;
+		};
+
+		if (head == tail_junk)
+			return;
+
+		// Depth-First Traversal
+		marks.reset(next_id);
+
+		std::vector<frame> v_list;
+
+		marks.mark(head->id);
+		v_list.push_back(frame{ head, edge_begin(head), fold_func(ContVal{}, transform_func(head->data)) });
+
+		while (!v_list.empty())
+		{
+			auto &top = v_list.back();
+
+			if (top.node->edge_count == 0)
+			{
+				// Store the given path's value
+				container.push_back(std::move(top.acc));
+				v_list.pop_back();
+				continue;
+			}
+
+			// Resume scanning where this vertex stopped last time
+			while (top.cursor != edge_end() && marks.is_marked(top.cursor.target()->id))
+				++top.cursor;
+
+			if (top.cursor != edge_end())
+			{
+				auto child = top.cursor.target();
+				++top.cursor;
+
+				marks.mark(child->id);
+
+				// Folded before push_back() may invalidate <top>
+				auto acc = fold_func(top.acc, transform_func(child->data));
+				v_list.push_back(frame{ child, edge_begin(child), std::move(acc) });
+			}
+			else
+			{
+				// Refresh childs of this vertex node before going to a higher level
+				_for_each_edge(top.node, [&marks](VNode to, const W&) { marks.unmark(to->id); });
+
+				v_list.pop_back();
+			}
+		}
+	}
+
+	template <class T, class W>
+	template <class U>
+	auto graph_list<T, W>::add_vertex_property(const U& initial) -> vertex_property<U>&
+	{
+		std::unique_ptr<vertex_property<U>> property(new vertex_property<U>(next_id, initial));
+		auto& column = *property;
+
+		vertex_properties.push_back(std::move(property));
+
+		return column;
+	}
+
+	template <class T, class W>
+	auto graph_list<T, W>::remove_vertex_property(const vertex_property_base& property) throw(std::invalid_argument) -> void
+	{
+		for (auto it = vertex_properties.begin(); it != vertex_properties.end(); it++)
+			if (it->get() == &property)
+			{
+				vertex_properties.erase(it);
+				return;
+			}
+
+		throw std::invalid_argument("Property doesn't belong to this graph");
+	}
+
+	template <class T, class W>
+	auto graph_list<T, W>::vertex_data(const VertexNode<T, W>* const node) const throw(std::invalid_argument) -> T
+	{
+		if (node == nullptr)
+			throw std::invalid_argument("Vertex node can't be null");
+
+		return node->data;
+	}
+
+	template <class T, class W>
+	auto graph_list<T, W>::add_vertex(T vertex_data) throw(std::length_error) -> VertexNode<T, W>*
+	{
+		// Ids stay below UINT32_MAX, so id_bound() fits in 32 bits too
+		if (free_ids.empty() && next_id == UINT32_MAX)
+			throw std::length_error("Graph ran out of vertex ids");
+
+		// Dense id: released ones are reused first
+		auto id = free_ids.empty() ? next_id : free_ids.back();
+
+		// Property slots are set up before anything that can't be undone
+		for (auto& property : vertex_properties)
+			property->prepare(id);
+
+		if (uses_edge_arrays && edge_arrays.size() <= id)
+			edge_arrays.resize(id + 1);
+
+		if (tracks_in_edges && in_edge_lists.size() <= id)
+			in_edge_lists.resize(id + 1);
+
+		auto node = _new_vertex(vertex_data);
+
+		// Tail
+		if (tail_junk != tail)
+		{
+			tail->next = node;
+			node->prev = tail;
+		}
+
+		tail = node;
+		node->next = tail_junk;
+
+		// Head
+		if (tail_junk == head)
+			head = node;
+
+		size_++;
+
+		node->id = id;
+		if (free_ids.empty())
+			next_id++;
+		else
+			free_ids.pop_back();
+
+		if (is_indexed)
+		{
+			// Keeps pointing to the first vertex if payload is already there
+			auto res = vertex_index.insert(std::make_pair(node->data, std::make_pair(node, size_t{})));
+			res.first->second.second++;
+		}
+
+		return node;
+	}
+
+	template <class T, class W>
+	auto graph_list<T, W>::add_vertices(std::initializer_list<T> vertices) throw(std::length_error) -> void
+	{
+		for (auto &v : vertices)
+			add_vertex(v);
+	}
+
+	template <class T, class W>
+	auto graph_list<T, W>::add_edge(W weight, VertexNode<T, W>* const from, VertexNode<T, W>* const to) -> void
+	{
+		if (uses_edge_arrays)
+		{
+			_push_edge(weight, from, to);
+			return;
+		}
+
+		auto node = _new_edge(weight, to);
+
+		if (from->edge_head == edge_tail_junk)
+			from->edge_head = node;
+		else
+			from->edge_tail->next = node;
+
+		node->prev = from->edge_tail;
+		from->edge_tail = node;
+		from->edge_count++;
+
+		if (tracks_in_edges)
+			_track_in_edge(from, node);
+	}
+
+	template <class T, class W>
+	auto graph_list<T, W>::add_edge(W weight, T from, T to) throw(std::invalid_argument) -> void
+	{
+		auto first = find_vertex(from);
+		auto second = find_vertex(to);
+
+		if (first == nullptr || second == nullptr)
+			throw std::invalid_argument("Given values are invalid. Can't find a vertex");
+
+		add_edge(weight, first, second);
+	}
+
+	template <class T, class W>
+	auto graph_list<T, W>::add_edges(std::initializer_list<std::tuple<W, T, T>> edges) throw(std::invalid_argument) -> void
+	{
+		for (auto &e : edges)
+			add_edge(std::get<0>(e), std::get<1>(e), std::get<2>(e));
+	}
+
+	template <class T, class W>
+	auto graph_list<T, W>::add_edges_from(VertexNode<T, W>* const from,
+		std::initializer_list<std::pair<W, VertexNode<T, W>*>> neighbors) throw(std::invalid_argument) -> void
+	{
+		add_edges_from(from, neighbors.begin(), neighbors.end());
+	}
+
+	template <class T, class W>
+	template <class Iter, class Enable>
+	auto graph_list<T, W>::add_edges_from(VertexNode<T, W>* const from, const Iter& _begin, const Iter& _end) throw(std::invalid_argument) -> void
+	{
+		if (from == nullptr)
+			throw std::invalid_argument("Vertex node can't be null");
+
+		// Whole range is checked before anything is allocated
+		for (auto it = _begin; it != _end; it++)
+			if (it->second == nullptr)
+				throw std::invalid_argument("Vertex node can't be null");
+
+		if (uses_edge_arrays)
+		{
+			auto& arrays = edge_arrays[from->id];
+			auto old_count = arrays.targets.size();
+			auto new_count = old_count + std::distance(_begin, _end);
+
+			arrays.targets.reserve(new_count);
+			arrays.weights.reserve(new_count);
+
+			try
+			{
+				for (auto it = _begin; it != _end; it++)
+					_push_edge(it->first, from, it->second);
+			}
+			catch (...)
+			{
+				// Weight copy failed: the batch is taken back
+				from->edge_count -= arrays.targets.size() - old_count;
+				arrays.targets.erase(arrays.targets.begin() + old_count, arrays.targets.end());
+				arrays.weights.erase(arrays.weights.begin() + old_count, arrays.weights.end());
+				throw;
+			}
+
+			return;
+		}
+
+		EdgeNode<T, W> *first{}, *last{};
+		size_t count{};
+
+		// Keep the batch adjacent in memory
+		if (uses_arena)
+			_arena_reserve(std::distance(_begin, _end) * _arena_round(sizeof(EdgeNode<T, W>)));
+
+		// Build the chain aside ...
+		try
+		{
+			for (auto it = _begin; it != _end; it++)
+			{
+				auto node = _new_edge(it->first, it->second);
+
+				if (first == nullptr)
+					first = node;
+				else
+					last->next = node;
+
+				node->prev = last;
+				last = node;
+				count++;
+			}
+		}
+		catch (...)
+		{
+			// Allocation or weight copy failed: the partial chain isn't linked anywhere yet
+			for (auto eit = first; eit != nullptr && eit != edge_tail_junk; )
+			{
+				auto e_next = eit->next;
+				_delete_edge(eit);
+				eit = e_next;
+			}
+
+			throw;
+		}
+
+		if (count == 0)
+			return;
+
+		// ... and splice it in one go
+		if (from->edge_head == edge_tail_junk)
+			from->edge_head = first;
+		else
+			from->edge_tail->next = first;
+
+		first->prev = from->edge_tail;
+		from->edge_tail = last;
+		from->edge_count += count;
+
+		if (tracks_in_edges)
+			for (auto eit = first; eit != edge_tail_junk; eit = eit->next)
+				_track_in_edge(from, eit);
+	}
+
+	template <class T, class W>
+	auto graph_list<T, W>::find_vertex(const T& data_to_found) const -> VertexNode<T, W>*
+	{
+		if (is_indexed)
+		{
+			auto found = vertex_index.find(data_to_found);
+			return found == vertex_index.end() ? nullptr : found->second.first;
+		}
+
+		for (auto it = begin(); it != end(); it++)
+			if (*it == data_to_found)
+				return it.get_node();
+
+		// Means "not found"
+		return nullptr;
+	}
+
+	template <class T, class W>
+	auto graph_list<T, W>::remove_vertex(VertexNode<T, W>* node) throw(std::invalid_argument, std::logic_error) -> void
+	{
+		if (node == nullptr)
+			throw std::invalid_argument("Vertex node can't be null");
+
+		// Vertex of another graph (or a sentinel)
+		if (node->owner != this)
+			throw std::invalid_argument("Unknown vertex node");
+
+		// Before anything is changed: a stale index throws
+		if (is_indexed)
+			_unindex_vertex(node);
+
+		// Remove all vertex' edges
+		EdgeNode<T, W>* curr = node->edge_head, *e_tmp{};
+		VertexNode<T, W> *v_temp{};
+
+		// First: Remove all edges in other vertixes that point to the one that's being removed
+		if (tracks_in_edges)
+		{
+			// Every entry knows its edge, so each one is unlinked in O(1) and drops itself
+			auto &in_edges = in_edge_lists[node->id];
+			while (!in_edges.empty())
+			{
+				auto in_edge = in_edges.back();
+
+				// Self-loops go away with the vertex' own edges
+				if (in_edge.first == node)
+					in_edges.pop_back();
+				else
+					_unlink_edge(in_edge.first, in_edge.second);
+			}
+		}
+		else
+		{
+			v_temp = head;
+			while (v_temp != tail_junk)
+			{
+				_remove_edges_to(v_temp, node);
+				v_temp = v_temp->next;
+			}
+		}
+
+		// Second: Remove this vertex' all edges
+		while (curr && curr != edge_tail_junk)
+		{
+			e_tmp = curr->next;
+
+			if (tracks_in_edges && curr->connects_to != node)
+				_erase_in_edge(curr);
+
+			_delete_edge(curr);
+			curr = e_tmp;
+		}
+
+		// The id's slots are left empty for the next vertex to get it
+		if (uses_edge_arrays)
+			edge_arrays[node->id] = EdgeArrays<T, W>();
+
+		if (tracks_in_edges)
+			std::vector<std::pair<VertexNode<T, W>*, EdgeNode<T, W>*>>().swap(in_edge_lists[node->id]);
+
+		// Third: Remove the vertex itself
+		if (head == node)
+			head = node->next;
+		else
+			node->prev->next = node->next;
+
+		if (tail == node)
+			tail = node->prev;
+		else
+			node->next->prev = node->prev;
+
+		free_ids.push_back(node->id);
+		_delete_vertex(node);
+
+		size_--;
+
+		// Clean up things
+		if (size_ == 0)
+		{
+			head = tail = tail_junk;
+			free_ids.clear();
+			next_id = 0;
+			edge_arrays.clear();
+			in_edge_lists.clear();
+			_release_blocks();
+			_release_arena();
+		}
+	}
+
+	template <class T, class W>
+	auto graph_list<T, W>::remove_egde(VertexNode<T, W>* from, VertexNode<T, W>* to) throw(std::invalid_argument) -> void
+	{
+		if (from == nullptr || to == nullptr)
+			throw std::invalid_argument("Vertex nodes can't be null");
+
+		if (from->owner != this || to->owner != this)
+			throw std::invalid_argument("Unknown vertex node");
+
+		// Find egde to delete
+		for (auto eit = from->edge_head; eit != edge_tail_junk; eit = eit->next)
+		{
+			if (eit->connects_to == to)
+			{
+				_unlink_edge(from, eit);
+				return;
+			}
+		}
+
+		auto& targets = _arrays_of(from).targets;
+		for (size_t e = 0; e < targets.size(); e++)
+		{
+			if (targets[e] == to)
+			{
+				_erase_array_edge(from, e);
+				return;
+			}
+		}
+	}
+
+	template <class T, class W>
+	auto graph_list<T, W>::_delete_vertex(VertexNode<T, W>* node) throw() -> void
+	{
+		// Vertices from the compacted block are released all at once
+		if (node >= vertex_block && node < vertex_block + vertex_block_size)
+		{
+			node->~VertexNode<T, W>();
+			return;
+		}
+
+		// Arena memory is given back by clear()
+		if (uses_arena)
+		{
+			node->~VertexNode<T, W>();
+			return;
+		}
+
+		delete node;
+	}
+
+	template <class T, class W>
+	auto graph_list<T, W>::_delete_edge(EdgeNode<T, W>* node) throw() -> void
+	{
+		// Edges from the compacted block are released all at once
+		if (node >= edge_block && node < edge_block + edge_block_size)
+		{
+			node->~EdgeNode<T, W>();
+			return;
+		}
+
+		// Arena memory is given back by clear()
+		if (uses_arena)
+		{
+			node->~EdgeNode<T, W>();
+			return;
+		}
+
+		delete node;
+	}
+
+	template <class T, class W>
+	auto graph_list<T, W>::_release_blocks() throw() -> void
+	{
+		if (vertex_block != nullptr)
+			::operator delete(vertex_block);
+
+		if (edge_block != nullptr)
+			::operator delete(edge_block);
+
+		vertex_block = nullptr;
+		edge_block = nullptr;
+		vertex_block_size = edge_block_size = 0;
+	}
+
+	template <class T, class W>
+	auto graph_list<T, W>::_new_vertex(T vertex_data) -> VertexNode<T, W>*
+	{
+		auto node = uses_arena ?
+			new (_arena_alloc(sizeof(VertexNode<T, W>))) VertexNode<T, W>(vertex_data, false, tail_junk, edge_tail_junk) :
+			new VertexNode<T, W>(vertex_data, false, tail_junk, edge_tail_junk);
+
+		node->owner = this;
+		return node;
+	}
+
+	template <class T, class W>
+	auto graph_list<T, W>::_new_edge(W weight, VertexNode<T, W>* to) -> EdgeNode<T, W>*
+	{
+		if (uses_arena)
+			return new (_arena_alloc(sizeof(EdgeNode<T, W>))) EdgeNode<T, W>(weight, to, edge_tail_junk);
+
+		return new EdgeNode<T, W>(weight, to, edge_tail_junk);
+	}
+
+	template <class T, class W>
+	auto graph_list<T, W>::_arena_round(size_t bytes) -> size_t
+	{
+		const size_t align = std::alignment_of<VertexNode<T, W>>::value > std::alignment_of<EdgeNode<T, W>>::value ?
+			std::alignment_of<VertexNode<T, W>>::value : std::alignment_of<EdgeNode<T, W>>::value;
+
+		return (bytes + align - 1) / align * align;
+	}
+
+	template <class T, class W>
+	auto graph_list<T, W>::_arena_reserve(size_t bytes) -> void
+	{
+		if (static_cast<size_t>(arena_end - arena_pos) >= bytes)
+			return;
+
+		// Rest of the current block is abandoned
+		auto block_size = bytes > arena_block_size ? bytes : arena_block_size;
+		auto block = static_cast<char*>(::operator new(block_size));
+		arena_blocks.push_back(block);
+
+		arena_pos = block;
+		arena_end = block + block_size;
+	}
+
+	template <class T, class W>
+	auto graph_list<T, W>::_arena_alloc(size_t bytes) -> void*
+	{
+		bytes = _arena_round(bytes);
+		_arena_reserve(bytes);
+
+		auto ptr = arena_pos;
+		arena_pos += bytes;
+
+		return ptr;
+	}
+
+	template <class T, class W>
+	auto graph_list<T, W>::_release_arena() throw() -> void
+	{
+		for (auto block : arena_blocks)
+			::operator delete(block);
+
+		arena_blocks.clear();
+		arena_pos = arena_end = nullptr;
+	}
+
+	template <class T, class W>
+	auto graph_list<T, W>::enable_arena(size_t block_size) throw(std::logic_error) -> void
+	{
+		if (size() != 0)
+			throw std::logic_error("Arena mode can only be switched on an empty graph");
+
+		uses_arena = true;
+		arena_block_size = _arena_round(block_size);
+	}
+
+	template <class T, class W>
+	auto graph_list<T, W>::disable_arena() throw(std::logic_error) -> void
+	{
+		if (size() != 0)
+			throw std::logic_error("Arena mode can only be switched on an empty graph");
+
+		_release_arena();
+		uses_arena = false;
+	}
+
+	template <class T, class W>
+	auto graph_list<T, W>::enable_edge_arrays() throw(std::logic_error) -> void
+	{
+		if (tracks_in_edges)
+			throw std::logic_error("Edge arrays can't be used while incoming edges are tracked");
+
+		// Arrays are sized up front, so only a throwing weight copy can stop the move below
+		if (edge_arrays.size() < next_id)
+			edge_arrays.resize(next_id);
+
+		for (auto node = head; node != tail_junk; node = node->next)
+		{
+			edge_arrays[node->id].targets.reserve(node->edge_count);
+			edge_arrays[node->id].weights.reserve(node->edge_count);
+		}
+
+		// From here on both storages are walked, so a vertex that keeps its chain is fine
+		uses_edge_arrays = true;
+
+		for (auto node = head; node != tail_junk; node = node->next)
+		{
+			auto& arrays = edge_arrays[node->id];
+			auto old_count = arrays.targets.size();
+
+			try
+			{
+				for (auto edge = node->edge_head; edge != edge_tail_junk; edge = edge->next)
+				{
+					arrays.weights.push_back(edge->weight);
+					arrays.targets.push_back(edge->connects_to);
+				}
+			}
+			catch (...)
+			{
+				// The chain is still whole: drop its copies
+				arrays.targets.erase(arrays.targets.begin() + old_count, arrays.targets.end());
+				arrays.weights.erase(arrays.weights.begin() + old_count, arrays.weights.end());
+				throw;
+			}
+
+			// Chained edges come first
+			std::rotate(arrays.targets.begin(), arrays.targets.begin() + old_count, arrays.targets.end());
+			std::rotate(arrays.weights.begin(), arrays.weights.begin() + old_count, arrays.weights.end());
+
+			for (auto edge = node->edge_head; edge != edge_tail_junk; )
+			{
+				auto next = edge->next;
+				_delete_edge(edge);
+				edge = next;
+			}
+
+			node->edge_head = edge_tail_junk;
+			node->edge_tail = nullptr;
+		}
+	}
+
+	template <class T, class W>
+	auto graph_list<T, W>::disable_edge_arrays() -> void
+	{
+		if (!uses_edge_arrays)
+			return;
+
+		for (auto node = head; node != tail_junk; node = node->next)
+		{
+			auto& arrays = edge_arrays[node->id];
+			if (arrays.targets.empty())
+				continue;
+
+			EdgeNode<T, W> *first{}, *last{};
+
+			// Keep the vertex' edges adjacent in memory
+			if (uses_arena)
+				_arena_reserve(arrays.targets.size() * _arena_round(sizeof(EdgeNode<T, W>)));
+
+			// Build the chain aside ...
+			try
+			{
+				for (size_t e = 0; e < arrays.targets.size(); e++)
+				{
+					auto edge = _new_edge(arrays.weights[e], arrays.targets[e]);
+
+					if (first == nullptr)
+						first = edge;
+					else
+						last->next = edge;
+
+					edge->prev = last;
+					last = edge;
+				}
+			}
+			catch (...)
+			{
+				// Vertices done so far have chains, this one keeps its arrays: both are walked
+				for (auto edge = first; edge != nullptr && edge != edge_tail_junk; )
+				{
+					auto next = edge->next;
+					_delete_edge(edge);
+					edge = next;
+				}
+
+				throw;
+			}
+
+			// ... and append it after the chained edges, which come first
+			if (node->edge_head == edge_tail_junk)
+				node->edge_head = first;
 			else
+				node->edge_tail->next = first;
+
+			first->prev = node->edge_tail;
+			node->edge_tail = last;
+
+			arrays = EdgeArrays<T, W>();
+		}
+
+		// All arrays are empty now: give back their slots
+		std::deque<EdgeArrays<T, W>>().swap(edge_arrays);
+		uses_edge_arrays = false;
+	}
+
+	template <class T, class W>
+	template <class Hash>
+	auto graph_list<T, W>::enable_vertex_index(Hash hash) -> void
+	{
+		vertex_index = vertex_index_type(size(), hash);
+		is_indexed = true;
+
+		_rebuild_vertex_index();
+	}
+
+	template <class T, class W>
+	auto graph_list<T, W>::disable_vertex_index() -> void
+	{
+		vertex_index = vertex_index_type();
+		is_indexed = false;
+	}
+
+	template <class T, class W>
+	auto graph_list<T, W>::_rebuild_vertex_index() -> void
+	{
+		vertex_index.clear();
+
+		for (auto vit = begin(); vit != end(); vit++)
+		{
+			auto res = vertex_index.insert(std::make_pair(*vit, std::make_pair(vit.get_node(), size_t{})));
+			res.first->second.second++;
+		}
+	}
+
+	template <class T, class W>
+	template <class Func>
+	auto graph_list<T, W>::_map_payloads(Func&& func) -> void
+	{
+		if (!is_indexed)
+		{
+			func();
+			return;
+		}
+
+		try
+		{
+			func();
+		}
+		catch (...)
+		{
+			_rebuild_vertex_index();
+			throw;
+		}
+
+		_rebuild_vertex_index();
+	}
+
+	template <class T, class W>
+	auto graph_list<T, W>::_unindex_vertex(const VertexNode<T, W>* node) throw(std::logic_error) -> void
+	{
+		// A missing entry means the payload was changed behind the index, which then
+		// still points at this node under the old value
+		auto found = vertex_index.find(node->data);
+		if (found == vertex_index.end())
+			throw std::logic_error("Vertex index is out of date");
+
+		if (--found->second.second == 0)
+		{
+			vertex_index.erase(found);
+			return;
+		}
+
+		// Duplicate payloads: move the entry to the next vertex with the same payload
+		if (found->second.first == node)
+		{
+			for (auto vit = node->next; vit != tail_junk; vit = vit->next)
+			{
+				if (vit->data == node->data)
+				{
+					found->second.first = vit;
+					break;
+				}
+			}
+		}
+	}
+
+	template <class T, class W>
+	auto graph_list<T, W>::enable_in_edges() throw(std::logic_error) -> void
+	{
+		if (uses_edge_arrays)
+			throw std::logic_error("Incoming edges can't be tracked in edge arrays mode");
+
+		in_edge_lists.clear();
+		in_edge_lists.resize(next_id);
+
+		for (auto vit = begin(); vit != end(); vit++)
+			for (auto eit = edge_begin(vit.get_node()); eit != edge_end(); eit++)
+				_track_in_edge(vit.get_node(), eit.get_node());
+
+		tracks_in_edges = true;
+	}
+
+	template <class T, class W>
+	auto graph_list<T, W>::disable_in_edges() -> void
+	{
+		std::vector<std::vector<std::pair<VertexNode<T, W>*, EdgeNode<T, W>*>>>().swap(in_edge_lists);
+		tracks_in_edges = false;
+	}
+
+	template <class T, class W>
+	auto graph_list<T, W>::in_edge_size(const VertexNode<T, W>* const node) const throw(std::invalid_argument, std::logic_error) -> size_t
+	{
+		if (node == nullptr)
+			throw std::invalid_argument("Vertex node can't be null");
+
+		if (!tracks_in_edges)
+			throw std::logic_error("Incoming edges are not tracked");
+
+		return in_edge_lists[node->id].size();
+	}
+
+	template <class T, class W>
+	auto graph_list<T, W>::_remove_edges_to(VertexNode<T, W>* from, const VertexNode<T, W>* to) -> void
+	{
+		EdgeNode<T, W> *curr = from->edge_head, *next{};
+
+		while (curr != edge_tail_junk)
+		{
+			next = curr->next;
+
+			if (curr->connects_to == to)
+				_unlink_edge(from, curr);
+
+			curr = next;
+		}
+
+		// Edge arrays: kept edges slide down over the removed ones
+		auto &targets = _arrays_of(from).targets;
+		auto &weights = _arrays_of(from).weights;
+		size_t kept{};
+
+		for (size_t e = 0; e < targets.size(); e++)
+		{
+			if (targets[e] == to)
+				continue;
+
+			if (kept != e)
+			{
+				targets[kept] = targets[e];
+				weights[kept] = std::move(weights[e]);
+			}
+
+			kept++;
+		}
+
+		from->edge_count -= targets.size() - kept;
+		targets.erase(targets.begin() + kept, targets.end());
+		weights.erase(weights.begin() + kept, weights.end());
+	}
+
+	template <class T, class W>
+	auto graph_list<T, W>::_push_edge(W weight, VertexNode<T, W>* from, VertexNode<T, W>* to) -> void
+	{
+		auto& arrays = edge_arrays[from->id];
+
+		// Weight goes first: if copying it throws, the arrays are still in step
+		arrays.weights.push_back(weight);
+
+		try
+		{
+			arrays.targets.push_back(to);
+		}
+		catch (...)
+		{
+			arrays.weights.pop_back();
+			throw;
+		}
+
+		from->edge_count++;
+	}
+
+	template <class T, class W>
+	auto graph_list<T, W>::_erase_array_edge(VertexNode<T, W>* from, size_t pos) -> void
+	{
+		auto& arrays = edge_arrays[from->id];
+		arrays.targets.erase(arrays.targets.begin() + pos);
+		arrays.weights.erase(arrays.weights.begin() + pos);
+		from->edge_count--;
+	}
+
+	template <class T, class W>
+	template <class Func>
+	auto graph_list<T, W>::_for_each_edge(const VertexNode<T, W>* node, Func&& func) const -> void
+	{
+		for (auto edge = node->edge_head; edge != edge_tail_junk; edge = edge->next)
+			func(edge->connects_to, edge->weight);
+
+		auto& arrays = _arrays_of(node);
+		for (size_t e = 0, count = arrays.targets.size(); e < count; e++)
+			func(arrays.targets[e], arrays.weights[e]);
+	}
+
+	template <class T, class W>
+	auto graph_list<T, W>::_unlink_edge(VertexNode<T, W>* from, EdgeNode<T, W>* edge) -> void
+	{
+		if (edge->prev == nullptr)
+			from->edge_head = edge->next;
+		else
+			edge->prev->next = edge->next;
+
+		// The sentinel is shared, so its <prev> is never set
+		if (edge->next == edge_tail_junk)
+			from->edge_tail = edge->prev;
+		else
+			edge->next->prev = edge->prev;
+
+		from->edge_count--;
+
+		if (tracks_in_edges)
+			_erase_in_edge(edge);
+
+		_delete_edge(edge);
+	}
+
+	template <class T, class W>
+	auto graph_list<T, W>::_track_in_edge(VertexNode<T, W>* from, EdgeNode<T, W>* edge) -> void
+	{
+		auto &entries = in_edge_lists[edge->connects_to->id];
+
+		edge->in_slot = entries.size();
+		entries.push_back(std::make_pair(from, edge));
+	}
+
+	template <class T, class W>
+	auto graph_list<T, W>::_erase_in_edge(EdgeNode<T, W>* edge) -> void
+	{
+		auto &entries = in_edge_lists[edge->connects_to->id];
+
+		// The last entry takes the freed slot
+		entries[edge->in_slot] = entries.back();
+		entries[edge->in_slot].second->in_slot = edge->in_slot;
+		entries.pop_back();
+	}
+
+	template <class T, class W>
+	auto graph_list<T, W>::compact() -> void
+	{
+		if (empty()) return;
+
+		// Only chained edges go to the block, edge arrays stay with their vertex id
+		size_t edge_count{};
+		for (auto vit = begin(); vit != end(); vit++)
+			edge_count += edge_size(vit.get_node()) - _arrays_of(vit.get_node()).targets.size();
+
+		// Both blocks are allocated before any node moves: if either allocation fails,
+		// the guards give back what was taken and the graph is left untouched
+		struct block_deleter { auto operator()(void* block) const -> void { ::operator delete(block); } };
+
+		std::unique_ptr<void, block_deleter> v_guard(::operator new(size() * sizeof(VertexNode<T, W>)));
+		std::unique_ptr<void, block_deleter> e_guard(edge_count == 0 ? nullptr :
+			::operator new(edge_count * sizeof(EdgeNode<T, W>)));
+
+		auto v_block = static_cast<VertexNode<T, W>*>(v_guard.release());
+		auto e_block = static_cast<EdgeNode<T, W>*>(e_guard.release());
+
+		VertexNode<T, W> *v_old = head, *v_succ{};
+		EdgeNode<T, W> *e_old{}, *e_succ{}, *e_pred{};
+		size_t idx{};
+
+		// First: move vertices into the block. Until edges are relocated, old vertex' <next>
+		// is a forwarding pointer to its copy and copy's <next> points back to the old vertex
+		while (v_old != tail_junk)
+		{
+			new (&v_block[idx++]) VertexNode<T, W>(std::move(v_old->data), v_old->is_visited, v_old, v_old->edge_head);
+			v_block[idx - 1].edge_count = v_old->edge_count;
+			v_block[idx - 1].id = v_old->id;
+			v_block[idx - 1].owner = this;
+
+			v_succ = v_old->next;
+			v_old->next = &v_block[idx - 1];
+			v_old = v_succ;
+		}
+
+		// Second: copy edges vertex by vertex, resolving targets via forwarding pointers
+		idx = 0;
+		for (size_t v = 0; v < size(); v++)
+		{
+			e_old = v_block[v].edge_head;
+			e_pred = nullptr;
+			v_block[v].edge_head = edge_tail_junk;
+
+			while (e_old != edge_tail_junk)
+			{
+				auto edge = new (&e_block[idx++]) EdgeNode<T, W>(e_old->weight, e_old->connects_to->next, edge_tail_junk);
+
+				if (e_pred == nullptr)
+					v_block[v].edge_head = edge;
+				else
+					e_pred->next = edge;
+
+				edge->prev = e_pred;
+				e_pred = edge;
+
+				// In-edge lists stay with the vertex id and keep their order: the copy takes over the old edge's slot
+				if (tracks_in_edges)
+				{
+					edge->in_slot = e_old->in_slot;
+					in_edge_lists[edge->connects_to->id][edge->in_slot] = std::make_pair(&v_block[v], edge);
+				}
+
+				e_succ = e_old->next;
+				_delete_edge(e_old);
+				e_old = e_succ;
+			}
+
+			v_block[v].edge_tail = e_pred;
+
+			for (auto &to : _arrays_of(&v_block[v]).targets)
+				to = to->next;
+		}
+
+		// Third: drop old vertices and restore <next> links
+		for (size_t v = 0; v < size(); v++)
+		{
+			_delete_vertex(v_block[v].next);
+			v_block[v].next = (v + 1 < size()) ? &v_block[v + 1] : tail_junk;
+			v_block[v].prev = (v > 0) ? &v_block[v - 1] : nullptr;
+		}
+
+		head = &v_block[0];
+		tail = &v_block[size() - 1];
+
+		if (is_indexed)
+			_rebuild_vertex_index();
+
+		// Previous blocks and the arena (if any) hold no live nodes at this point
+		_release_blocks();
+		_release_arena();
+
+		vertex_block = v_block;
+		vertex_block_size = size();
+		edge_block = e_block;
+		edge_block_size = edge_count;
+	}
+
+	template <class T, class W>
+	auto graph_list<T, W>::_kahn(std::vector<VertexNode<T, W>*>& order, std::vector<size_t>* depth) const -> bool
+	{
+		std::vector<size_t> in_degree(next_id, 0);
+
+		order.clear();
+		order.reserve(size_);
+
+		for (auto node = head; node != tail_junk; node = node->next)
+			_for_each_edge(node, [&in_degree](VertexNode<T, W>* to, const W&) { in_degree[to->id]++; });
+
+		if (depth != nullptr)
+			depth->assign(next_id, 0);
+
+		// Sources go first, in vertex order
+		for (auto node = head; node != tail_junk; node = node->next)
+			if (in_degree[node->id] == 0)
+				order.push_back(node);
+
+		// <order> doubles as the queue: vertices after <done> are ready but not yet expanded
+		for (size_t done = 0; done < order.size(); done++)
+		{
+			auto node = order[done];
+
+			_for_each_edge(node, [&](VertexNode<T, W>* to, const W&) {
+				if (depth != nullptr && (*depth)[to->id] <= (*depth)[node->id])
+					(*depth)[to->id] = (*depth)[node->id] + 1;
+
+				if (--in_degree[to->id] == 0)
+					order.push_back(to);
+			});
+		}
+
+		return order.size() == size_;
+	}
+
+	template <class T, class W>
+	auto graph_list<T, W>::topological_sort() const throw(std::logic_error) -> std::vector<VertexNode<T, W>*>
+	{
+		std::vector<VertexNode<T, W>*> order;
+
+		if (!_kahn(order, nullptr))
+			throw std::logic_error("Graph has a cycle");
+
+		return order;
+	}
+
+	template <class T, class W>
+	auto graph_list<T, W>::topological_levels() const throw(std::logic_error) -> std::vector<std::vector<VertexNode<T, W>*>>
+	{
+		std::vector<VertexNode<T, W>*> order;
+		std::vector<size_t> depth;
+
+		if (!_kahn(order, &depth))
+			throw std::logic_error("Graph has a cycle");
+
+		std::vector<std::vector<VertexNode<T, W>*>> levels;
+		for (auto node : order)
+		{
+			if (depth[node->id] >= levels.size())
+				levels.resize(depth[node->id] + 1);
+
+			levels[depth[node->id]].push_back(node);
+		}
+
+		return levels;
+	}
+
+	template <class T, class W>
+	auto graph_list<T, W>::is_acyclic() const -> bool
+	{
+		std::vector<VertexNode<T, W>*> order;
+
+		return _kahn(order, nullptr);
+	}
+
+	template <class T, class W>
+	auto graph_list<T, W>::find_cycle() const -> std::vector<VertexNode<T, W>*>
+	{
+		using VNode = VertexNode<T, W>*;
+
+		// 0 - not reached yet, 1 - on the DFS stack, 2 - finished
+		std::vector<unsigned char> state(next_id, 0);
+		std::vector<std::pair<VNode, edge_iterator>> frames;
+		std::vector<VNode> cycle;
+
+		for (auto root = head; root != tail_junk; root = root->next)
+		{
+			if (state[root->id] != 0)
+				continue;
+
+			state[root->id] = 1;
+			frames.emplace_back(root, edge_begin(root));
+
+			while (!frames.empty())
 			{
-				bool all_visited = true;
-				for (auto it = edge_begin(temp); it != edge_end(); it++)
+				auto& frame = frames.back();
+
+				if (frame.second == edge_end())
 				{
-					if (it.get_node()->connects_to->is_visited == false)
-					{
-						v_list.push_back(it.get_node()->connects_to);
-						all_visited = false;
-						break;
-					}
+					state[frame.first->id] = 2;
+					frames.pop_back();
+					continue;
 				}
 
-				// Remove from the list only if all childs are visited
-				if (all_visited)
+				auto to = frame.second.target();
+				++frame.second;
+
+				if (state[to->id] == 1)
 				{
-					// Refresh childs of this vertex node before going to a higher level
-					for (auto it = edge_begin(v_list.back()); it != edge_end(); it++)
-						it.get_node()->connects_to->is_visited = false;
+					// Back edge: the cycle is the part of the stack starting at <to>
+					auto it = frames.begin();
+					while (it->first != to)
+						it++;
+
+					for (; it != frames.end(); it++)
+						cycle.push_back(it->first);
+
+					return cycle;
+				}
 
-					v_list.pop_back();
+				if (state[to->id] == 0)
+				{
+					state[to->id] = 1;
+					frames.emplace_back(to, edge_begin(to));
 				}
 			}
 		}
+
+		return cycle;
 	}
 
 	template <class T, class W>
-	auto graph_list<T, W>::vertex_data(const VertexNode<T, W>* const node) const throw(std::invalid_argument) -> T
+	auto graph_list<T, W>::is_reachable(const VertexNode<T, W>* from, const VertexNode<T, W>* to) const throw(std::invalid_argument) -> bool
 	{
-		if (node == nullptr)
+		if (from == nullptr || to == nullptr)
 			throw std::invalid_argument("Vertex node can't be null");
 
-		return node->data;
+		if (from == to)
+			return true;
+
+		visited_marks marks;
+		marks.reset(next_id);
+		marks.mark(from->id);
+
+		std::vector<const VertexNode<T, W>*> pending(1, from);
+		while (!pending.empty())
+		{
+			auto node = pending.back();
+			pending.pop_back();
+
+			bool found{};
+			_for_each_edge(node, [&](VertexNode<T, W>* child, const W&) {
+				if (child == to)
+					found = true;
+				else if (marks.test_and_mark(child->id))
+					pending.push_back(child);
+			});
+
+			if (found)
+				return true;
+		}
+
+		return false;
 	}
 
 	template <class T, class W>
-	auto graph_list<T, W>::add_vertex(T vertex_data) -> VertexNode<T, W>*
+	auto graph_list<T, W>::is_reachable(const T& from, const T& to) const throw(std::invalid_argument) -> bool
 	{
-		auto node = new VertexNode<T, W>(vertex_data, false, tail_junk, edge_tail_junk);
+		auto from_node = find_vertex(from);
+		auto to_node = find_vertex(to);
+		if (from_node == nullptr || to_node == nullptr)
+			throw std::invalid_argument("Can't find a vertex node with given value");
 
-		// Tail
-		if (tail_junk != tail)
-			tail->next = node;
+		return is_reachable(from_node, to_node);
+	}
 
-		tail = node;
-		node->next = tail_junk;
+	template <class T, class W>
+	auto graph_list<T, W>::_tarjan(std::vector<reachability_index::index_type>& component) const -> size_t
+	{
+		using VNode = VertexNode<T, W>*;
+		typedef reachability_index::index_type index_type;
 
-		// Head
-		if (tail_junk == head)
-			head = node;
+		const index_type npos = reachability_index::npos;
 
-		size_++;
+		// Discovery number and the lowest discovery number reachable from the DFS subtree
+		std::vector<index_type> order(next_id, npos), low(next_id, npos);
+		// Vertices of the components that aren't finished yet
+		std::vector<VNode> open;
+		std::vector<std::pair<VNode, edge_iterator>> frames;
+		index_type counter{}, count{};
 
-		return node;
+		component.assign(next_id, npos);
+
+		for (auto root = head; root != tail_junk; root = root->next)
+		{
+			if (order[root->id] != npos)
+				continue;
+
+			order[root->id] = low[root->id] = counter++;
+			open.push_back(root);
+			frames.emplace_back(root, edge_begin(root));
+
+			while (!frames.empty())
+			{
+				auto& frame = frames.back();
+				auto node = frame.first;
+
+				if (frame.second != edge_end())
+				{
+					auto to = frame.second.target();
+					++frame.second;
+
+					if (order[to->id] == npos)
+					{
+						order[to->id] = low[to->id] = counter++;
+						open.push_back(to);
+						frames.emplace_back(to, edge_begin(to));
+					}
+					// Discovered and not assigned yet: still open
+					else if (component[to->id] == npos)
+						low[node->id] = std::min(low[node->id], order[to->id]);
+
+					continue;
+				}
+
+				frames.pop_back();
+				if (!frames.empty())
+				{
+					auto parent = frames.back().first;
+					low[parent->id] = std::min(low[parent->id], low[node->id]);
+				}
+
+				// <node> is the root of a component: it's the open tail from <node> on
+				if (low[node->id] == order[node->id])
+				{
+					VNode member;
+					do
+					{
+						member = open.back();
+						open.pop_back();
+						component[member->id] = count;
+					} while (member != node);
+
+					count++;
+				}
+			}
+		}
+
+		return count;
 	}
 
 	template <class T, class W>
-	auto graph_list<T, W>::add_vertices(std::initializer_list<T> vertices) -> void
+	auto graph_list<T, W>::strongly_connected_components() const -> std::vector<std::vector<VertexNode<T, W>*>>
 	{
-		for (auto &v : vertices)
-			add_vertex(v);
+		std::vector<reachability_index::index_type> component;
+		std::vector<std::vector<VertexNode<T, W>*>> components(_tarjan(component));
+
+		for (auto node = head; node != tail_junk; node = node->next)
+			components[component[node->id]].push_back(node);
+
+		return components;
 	}
 
 	template <class T, class W>
-	auto graph_list<T, W>::add_edge(W weight, VertexNode<T, W>* const from, VertexNode<T, W>* const to) -> void
+	auto graph_list<T, W>::reachability(size_t closure_limit) const -> reachability_index
 	{
-		auto node = new EdgeNode<T, W>(weight, to, edge_tail_junk);
-
-		if (from->edge_head == edge_tail_junk)
-			from->edge_head = node;
-		else
-		{
-			// O(n) | Find last valid node
-			auto raw_it = from->edge_head;
+		typedef reachability_index::index_type index_type;
 
-			while (raw_it->next != edge_tail_junk)
-				raw_it = raw_it->next;
+		std::vector<index_type> component;
+		auto count = _tarjan(component);
 
-			raw_it->next = node;
-		}
+		// Condensed edges (duplicates are dropped by the index)
+		std::vector<std::pair<index_type, index_type>> edges;
+		for (auto node = head; node != tail_junk; node = node->next)
+			_for_each_edge(node, [&](VertexNode<T, W>* to, const W&) {
+				if (component[node->id] != component[to->id])
+					edges.emplace_back(component[node->id], component[to->id]);
+			});
 
-		node->next = edge_tail_junk;
+		return reachability_index(std::move(component), count, std::move(edges), closure_limit);
 	}
 
 	template <class T, class W>
-	auto graph_list<T, W>::add_edge(W weight, T from, T to) throw(std::invalid_argument) -> void
+	template <class Item, class Less>
+	auto graph_list<T, W>::_parallel_sort(std::vector<Item>& items, Less less, unsigned threads) -> void
 	{
-		auto first = find_vertex(from);
-		auto second = find_vertex(to);
+		// Small inputs aren't worth spawning threads for
+		const size_t grain = size_t{ 1 } << 16;
 
-		if (first == nullptr || second == nullptr)
-			throw std::invalid_argument("Given values are invalid. Can't find a vertex");
+		auto parts = parallel_parts(items.size(), threads, grain);
+		if (parts < 2)
+		{
+			std::sort(items.begin(), items.end(), less);
+			return;
+		}
 
-		add_edge(weight, first, second);
+		std::vector<size_t> bounds(parts + 1);
+		for (size_t p = 0; p <= parts; p++)
+			bounds[p] = items.size() * p / parts;
+
+		// Sort runs concurrently (one run per part) ...
+		parallel_for(parts, static_cast<unsigned>(parts), [&items, &bounds, &less](size_t first, size_t last, unsigned) {
+			for (auto p = first; p < last; p++)
+				std::sort(items.begin() + bounds[p], items.begin() + bounds[p + 1], less);
+		}, 1);
+
+		// ... then merge neighbouring runs, doubling their width every round
+		for (size_t width = 1; width < parts; width *= 2)
+			for (size_t p = 0; p + width < parts; p += 2 * width)
+				std::inplace_merge(items.begin() + bounds[p], items.begin() + bounds[p + width],
+					items.begin() + bounds[std::min(p + 2 * width, parts)], less);
 	}
 
 	template <class T, class W>
-	auto graph_list<T, W>::add_edges(std::initializer_list<std::tuple<W, T, T>> edges) throw(std::invalid_argument) -> void
+	auto graph_list<T, W>::kruskal_msf(unsigned threads) const -> std::vector<weighted_edge_type>
 	{
-		for (auto &e : edges)
-			add_edge(std::get<0>(e), std::get<1>(e), std::get<2>(e));
+		std::vector<weighted_edge_type> edges, forest;
+
+		for (auto node = head; node != tail_junk; node = node->next)
+			_for_each_edge(node, [&edges, node](VertexNode<T, W>* to, const W& weight) {
+				if (to != node)
+					edges.emplace_back(weight, node, to);
+			});
+
+		_parallel_sort(edges, [](const weighted_edge_type& a, const weighted_edge_type& b) {
+			return std::get<0>(a) < std::get<0>(b);
+		}, threads);
+
+		disjoint_sets sets(next_id);
+		forest.reserve(size_ > 0 ? size_ - 1 : 0);
+
+		for (auto& edge : edges)
+		{
+			if (!sets.unite(static_cast<disjoint_sets::index_type>(std::get<1>(edge)->id),
+				static_cast<disjoint_sets::index_type>(std::get<2>(edge)->id)))
+				continue;
+
+			forest.push_back(edge);
+
+			// Spanning tree is complete
+			if (forest.size() + 1 == size_)
+				break;
+		}
+
+		return forest;
 	}
 
 	template <class T, class W>
-	auto graph_list<T, W>::find_vertex(const T& data_to_found) const -> VertexNode<T, W>*
+	auto graph_list<T, W>::prim_msf() const -> std::vector<weighted_edge_type>
 	{
-		for (auto it = begin(); it != end(); it++)
-			if (*it == data_to_found)
-				return it.get_node();
+		typedef typename dary_heap<W>::index_type index_type;
 
-		// Means "not found"
-		return nullptr;
+		const index_type npos = static_cast<index_type>(-1);
+
+		// Undirected view in CSR layout: every edge is listed at both of its ends
+		std::vector<VertexNode<T, W>*> nodes(next_id, nullptr);
+		std::vector<size_t> offsets(next_id + 1, 0);
+
+		for (auto node = head; node != tail_junk; node = node->next)
+		{
+			nodes[node->id] = node;
+
+			_for_each_edge(node, [&offsets, node](VertexNode<T, W>* to, const W&) {
+				if (to != node)
+				{
+					offsets[node->id + 1]++;
+					offsets[to->id + 1]++;
+				}
+			});
+		}
+
+		for (size_t id = 0; id < next_id; id++)
+			offsets[id + 1] += offsets[id];
+
+		std::vector<index_type> neighbours(offsets.back());
+		std::vector<W> weights(offsets.back());
+		std::vector<size_t> fill(offsets.begin(), offsets.end() - 1);
+
+		for (auto node = head; node != tail_junk; node = node->next)
+			_for_each_edge(node, [&, node](VertexNode<T, W>* target, const W& weight) {
+				if (target != node)
+				{
+					auto from = node->id, to = target->id;
+
+					neighbours[fill[from]] = static_cast<index_type>(to);
+					weights[fill[from]++] = weight;
+					neighbours[fill[to]] = static_cast<index_type>(from);
+					weights[fill[to]++] = weight;
+				}
+			});
+
+		// Heap holds the lightest known edge into the tree for every vertex around it
+		dary_heap<W> heap(next_id);
+		std::vector<index_type> via(next_id, npos);
+		std::vector<bool> in_tree(next_id, false);
+		std::vector<weighted_edge_type> forest;
+
+		forest.reserve(size_ > 0 ? size_ - 1 : 0);
+
+		for (auto root = head; root != tail_junk; root = root->next)
+		{
+			if (in_tree[root->id])
+				continue;
+
+			heap.push_or_decrease(static_cast<index_type>(root->id), W{});
+			while (!heap.empty())
+			{
+				auto weight = heap.top_priority();
+				auto node = heap.pop();
+
+				in_tree[node] = true;
+				if (via[node] != npos)
+					forest.emplace_back(weight, nodes[via[node]], nodes[node]);
+
+				for (auto e = offsets[node]; e < offsets[node + 1]; e++)
+					if (!in_tree[neighbours[e]] && heap.push_or_decrease(neighbours[e], weights[e]))
+						via[neighbours[e]] = node;
+			}
+		}
+
+		return forest;
 	}
 
 	template <class T, class W>
-	auto graph_list<T, W>::remove_vertex(VertexNode<T, W>* node) throw(std::invalid_argument) -> void
+	auto graph_list<T, W>::freeze() const -> graph_csr<T, W>
 	{
-		// Remove all vertex' edges
-		EdgeNode<T, W>* curr = node->edge_head, *e_tmp{};
-		VertexNode<T, W> *v_temp{};
+		typedef typename graph_csr<T, W>::index_type index_type;
 
-		// First: Remove all edges in other vertixes that point to the one that's being removed
-		v_temp = head;
-		while (v_temp != tail_junk)
+		std::vector<index_type> index(next_id);
+		std::vector<T> vertices;
+		std::vector<size_t> offsets;
+		std::vector<index_type> targets;
+		std::vector<W> weights;
+
+		vertices.reserve(size());
+		offsets.reserve(size() + 1);
+
+		// First: assign dense indices
+		for (auto vit = begin(); vit != end(); vit++)
 		{
-			remove_egde(v_temp, node);
-			v_temp = v_temp->next;
+			index[vit.get_node()->id] = static_cast<index_type>(vertices.size());
+			vertices.push_back(*vit);
 		}
 
-		// Second: Remove this vertex' all edges
-		while (curr && curr != edge_tail_junk)
+		// Second: lay edges out row by row
+		offsets.push_back(0);
+		for (auto vit = begin(); vit != end(); vit++)
 		{
-			e_tmp = curr->next;
-			delete curr;
-			curr = e_tmp;
+			for (auto eit = edge_begin(vit.get_node()); eit != edge_end(); eit++)
+			{
+				targets.push_back(index[eit.target()->id]);
+				weights.push_back(*eit);
+			}
+
+			offsets.push_back(targets.size());
 		}
 
-		// Third: Remove the vertex itself
-		
-		// Deleting head vertex?
-		if (head == node)
+		return graph_csr<T, W>(std::move(vertices), std::move(offsets), std::move(targets), std::move(weights));
+	}
+
+	template <class T, class W>
+	auto graph_list<T, W>::load_edge_list(const std::string& path) throw(std::runtime_error, std::length_error) -> size_t
+	{
+		io::chunk_reader reader(path);
+
+		// Payload lookups go through the hash index for the time of loading; it grows with
+		// the vertices as they show up (sizing it ahead would take another pass over the file)
+		bool was_indexed = is_indexed;
+		if (!was_indexed)
+			enable_vertex_index();
+
+		const char *first{}, *last{};
+		size_t line{}, loaded{};
+		T src{}, dst{};
+		W weight{};
+
+		try
 		{
-			v_temp = head->next;
-			delete head;
-			head = v_temp;
+			while (reader.next_line(first, last))
+			{
+				line++;
+				io::skip_blanks(first, last);
+
+				// Blank line or comment
+				if (first == last || *first == '#' || *first == '%')
+					continue;
+
+				if (!io::parse_field(first, last, src) || !io::parse_field(first, last, dst))
+					throw std::runtime_error("Malformed edge list line " + std::to_string(line));
+
+				// Weight is optional
+				weight = W();
+				io::skip_blanks(first, last);
+				if (first != last && !io::parse_field(first, last, weight))
+					throw std::runtime_error("Malformed edge list line " + std::to_string(line));
+
+				io::skip_blanks(first, last);
+				if (first != last)
+					throw std::runtime_error("Malformed edge list line " + std::to_string(line));
+
+				auto from = find_vertex(src);
+				if (from == nullptr)
+					from = add_vertex(src);
+
+				auto to = find_vertex(dst);
+				if (to == nullptr)
+					to = add_vertex(dst);
+
+				add_edge(weight, from, to);
+				loaded++;
+			}
 		}
-		else
+		catch (...)
 		{
-			// Find predecessor
-			v_temp = head;
+			if (!was_indexed)
+				disable_vertex_index();
 
-			while (v_temp->next != node && v_temp != tail_junk)
-				v_temp = v_temp->next;
+			throw;
+		}
+
+		if (!was_indexed)
+			disable_vertex_index();
+
+		return loaded;
+	}
+
+	template <class T, class W>
+	auto graph_list<T, W>::load_edge_list_binary(const std::string& path) throw(std::runtime_error, std::length_error) -> size_t
+	{
+		static_assert(std::is_trivially_copyable<T>::value && std::is_trivially_copyable<W>::value,
+			"Binary edge lists need trivially copyable payloads and weights");
+
+		io::chunk_reader reader(path);
+		io::edge_list_header header;
+
+		if (!reader.read(&header, sizeof(header)) || std::memcmp(header.magic, io::edge_list_magic, sizeof(header.magic)) != 0)
+			throw std::runtime_error("Not a binary edge list: " + path);
+
+		if (header.payload_size != sizeof(T) || header.weight_size != sizeof(W))
+			throw std::runtime_error("Binary edge list was written for other payload/weight types");
+
+		if (header.vertex_count > UINT32_MAX)
+			throw std::runtime_error("Binary edge list has too many vertices");
 
-			// Unexpected situation
-			if (v_temp == tail_junk)
-				throw std::invalid_argument("Unknown vertex node");
+		// Counts come from the file: they have to fit in it before anything is reserved for them
+		auto remaining = reader.remaining();
+		if (header.vertex_count > remaining / sizeof(T)
+			|| header.edge_count > (remaining - header.vertex_count * sizeof(T)) / (2 * sizeof(std::uint32_t) + sizeof(W)))
+			throw std::runtime_error("Binary edge list is truncated");
 
-			v_temp->next = node->next;
-			delete node;
+		// Header tells how much is coming
+		std::vector<VertexNode<T, W>*> nodes;
+		nodes.reserve(static_cast<size_t>(header.vertex_count));
+
+		if (is_indexed)
+			vertex_index.reserve(size() + static_cast<size_t>(header.vertex_count));
+
+		T payload;
+		for (std::uint64_t v = 0; v < header.vertex_count; v++)
+		{
+			if (!reader.read(&payload, sizeof(T)))
+				throw std::runtime_error("Binary edge list is truncated");
+
+			nodes.push_back(add_vertex(payload));
 		}
 
-		size_--;
+		std::uint32_t ends[2];
+		W weight;
+		for (std::uint64_t e = 0; e < header.edge_count; e++)
+		{
+			if (!reader.read(ends, sizeof(ends)) || !reader.read(&weight, sizeof(W)))
+				throw std::runtime_error("Binary edge list is truncated");
 
-		// Clean up things
-		if (size_ == 0)
-			head = tail = tail_junk;
+			if (ends[0] >= nodes.size() || ends[1] >= nodes.size())
+				throw std::runtime_error("Binary edge list refers to an unknown vertex");
+
+			add_edge(weight, nodes[ends[0]], nodes[ends[1]]);
+		}
+
+		return static_cast<size_t>(header.edge_count);
 	}
 
 	template <class T, class W>
-	auto graph_list<T, W>::remove_egde(VertexNode<T, W>* from, VertexNode<T, W>* to) throw(std::invalid_argument) -> void
+	auto graph_list<T, W>::save_edge_list_binary(const std::string& path) const throw(std::runtime_error, std::length_error) -> void
 	{
-		if (from == nullptr || to == nullptr)
-			throw std::invalid_argument("Vertex nodes can't be null");
+		static_assert(std::is_trivially_copyable<T>::value && std::is_trivially_copyable<W>::value,
+			"Binary edge lists need trivially copyable payloads and weights");
 
-		if (from->edge_head == edge_tail_junk)
-			return;
+		// Edges refer to vertices by 32-bit positions
+		if (size() > UINT32_MAX)
+			throw std::length_error("Graph has too many vertices for a binary edge list");
 
-		EdgeNode<T, W>* tmp{};
+		std::ofstream stream(path, std::ios::out | std::ios::binary);
+		if (!stream.is_open())
+			throw std::runtime_error("Can't open file: " + path);
 
-		// Removing head edge?
-		if (from->edge_head->connects_to == to)
-		{
-			// Removing last edge?
-			if (from->edge_head->next == edge_tail_junk)
-			{
-				delete from->edge_head;
-				from->edge_head = edge_tail_junk;
-			}
-			else
-			{
-				tmp = from->edge_head->next;
-				delete from->edge_head;
-				from->edge_head = tmp;
-			}
+		io::edge_list_header header;
+		std::memcpy(header.magic, io::edge_list_magic, sizeof(header.magic));
+		header.vertex_count = size();
+		header.edge_count = 0;
+		header.payload_size = sizeof(T);
+		header.weight_size = sizeof(W);
 
-			return;
+		for (auto vit = begin(); vit != end(); vit++)
+			header.edge_count += edge_size(vit.get_node());
+
+		stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+		// Vertices are referred to by their position
+		std::vector<std::uint32_t> index(next_id);
+		std::uint32_t position{};
+		for (auto vit = begin(); vit != end(); vit++)
+		{
+			index[vit.get_node()->id] = position++;
+			stream.write(reinterpret_cast<const char*>(&*vit), sizeof(T));
 		}
 
-		// Find egde to delete and its predecessor
-		auto eit = from->edge_head, pred = from->edge_head;
-		while (eit != edge_tail_junk)
+		std::uint32_t ends[2];
+		for (auto vit = begin(); vit != end(); vit++)
 		{
-			if (eit->connects_to == to)
+			ends[0] = index[vit.get_node()->id];
+
+			for (auto eit = edge_begin(vit.get_node()); eit != edge_end(); eit++)
 			{
-				pred->next = eit->next;
-				delete eit;
-				
-				return;
+				ends[1] = index[eit.target()->id];
+				stream.write(reinterpret_cast<const char*>(ends), sizeof(ends));
+				stream.write(reinterpret_cast<const char*>(&*eit), sizeof(W));
 			}
-
-			pred = eit;
-			eit = eit->next;
 		}
+
+		if (!stream)
+			throw std::runtime_error("Can't write file: " + path);
 	}
 
 	template <class T, class W>
@@ -722,20 +2973,8 @@ namespace hadt {
 	{
 		if (node == nullptr)
 			throw std::invalid_argument("Vertex node can't be null");
-		
-		if (node->edge_head == edge_tail_junk)
-			return size_t{};
-
-		size_t edge_count{};
-
-		auto eit = node->edge_head;
-		while (eit != edge_tail_junk)
-		{
-			edge_count++;
-			eit = eit->next;
-		}
 
-		return edge_count;
+		return node->edge_count;
 	}
 
 	template <class T, class W>
@@ -759,10 +2998,10 @@ namespace hadt {
 			auto eit = edge_begin(vit.get_node());
 			if (eit != edge_end())
 			{
-				stream << "--> " << eit.get_node()->connects_to->data << "-" << *eit;
+				stream << "--> " << eit.target()->data << "-" << *eit;
 
 				while (++eit != edge_end())
-					stream << ", " << eit.get_node()->connects_to->data << "-" << *eit;
+					stream << ", " << eit.target()->data << "-" << *eit;
 			}
 
 			stream << std::endl;
@@ -784,9 +3023,9 @@ namespace hadt {
 		{
 			stream << "Vertex " << node->data << ": ";
 
-			stream << eit.get_node()->connects_to->data << "-" << *eit;
+			stream << eit.target()->data << "-" << *eit;
 			while (++eit != edge_end())
-				stream << "; " << eit.get_node()->connects_to->data << "-" << *eit;
+				stream << "; " << eit.target()->data << "-" << *eit;
 		}
 		else
 			stream << "Vertex " << node->data << " has no edges";
@@ -804,15 +3043,43 @@ namespace hadt {
 			if (head == tail_junk)
 				return;
 
-			VertexNode<T, W>* vit = head, *tmp{};
-			while (vit != tail_junk)
+			VertexNode<T, W>* vit = head, *v_tmp{};
+			EdgeNode<T, W>* eit{}, *e_tmp{};
+
+			// Arena nodes without a destructor to run are released with their blocks:
+			// if neither vertices nor edges have one, no node is visited at all
+			bool skip_edges = uses_arena && std::is_trivially_destructible<EdgeNode<T, W>>::value;
+			bool skip_vertices = uses_arena && std::is_trivially_destructible<VertexNode<T, W>>::value;
+
+			// Single sweep: nothing points outside of the graph,
+			// so incoming edges don't need to be looked up
+			while (!(skip_vertices && skip_edges) && vit != tail_junk)
 			{
-				tmp = vit->next;
-				remove_vertex(vit);
-				vit = tmp;
+				eit = skip_edges ? nullptr : vit->edge_head;
+				while (eit && eit != edge_tail_junk)
+				{
+					e_tmp = eit->next;
+					_delete_edge(eit);
+					eit = e_tmp;
+				}
+
+				v_tmp = vit->next;
+				if (!skip_vertices)
+					_delete_vertex(vit);
+				vit = v_tmp;
 			}
 		
 			head = tail = tail_junk;
+			size_ = 0;
+
+			free_ids.clear();
+			next_id = 0;
+			edge_arrays.clear();
+			in_edge_lists.clear();
+
+			vertex_index.clear();
+			_release_blocks();
+			_release_arena();
 		}
 		catch (...)
 		{
@@ -0,0 +1,450 @@
+#pragma once
+
+// std::forward_iterator_tag, std::iterator
+#include <iterator>
+
+// std::length_error, std::invalid_argument
+#include <stdexcept>
+
+// std::cout, std::endl, std::ostream
+#include <iostream>
+
+// std::move, std::forward, std::ptrdiff_t
+#include <utility>
+
+// std::is_same, std::decay, std::integral_constant, std::alignment_of, std::conditional
+#include <type_traits>
+
+// std::uint8_t
+#include <cstdint>
+
+// placement new
+#include <new>
+
+// std::unique_ptr
+#include <memory>
+
+#include "hadt_common.hpp"
+
+namespace hadt {
+
+	namespace meta {
+
+		// Largest sizeof() among Ts
+		template <class... Ts>
+		struct max_size : std::integral_constant<size_t, 1> {};
+
+		template <class T, class... Ts>
+		struct max_size<T, Ts...> : std::integral_constant<size_t,
+			(sizeof(T) > max_size<Ts...>::value) ? sizeof(T) : max_size<Ts...>::value> {};
+
+		// Strictest alignment among Ts
+		template <class... Ts>
+		struct max_align : std::integral_constant<size_t, 1> {};
+
+		template <class T, class... Ts>
+		struct max_align<T, Ts...> : std::integral_constant<size_t,
+			(std::alignment_of<T>::value > max_align<Ts...>::value) ? std::alignment_of<T>::value : max_align<Ts...>::value> {};
+
+		// Position of U in Ts (equals sizeof...(Ts) if U is not there)
+		template <class U, class... Ts>
+		struct index_of : std::integral_constant<size_t, 0> {};
+
+		template <class U, class T, class... Ts>
+		struct index_of<U, T, Ts...> : std::integral_constant<size_t,
+			std::is_same<U, T>::value ? 0 : 1 + index_of<U, Ts...>::value> {};
+	}
+
+	/* Doubly-linked list holding values of any of the types Ts...:
+	 *   -- each value is stored inline in its node (node storage fits the largest of Ts)
+	 *   -- a one-byte tag in the node tells which of Ts is stored
+	 *   -- visit() dispatches through a per-visitor table built at compile time
+	 *   -- for_each_of<U>() scans tags only and stops once all values of U are seen
+	 */
+	template <class... Ts>
+	class hetero_list
+	{
+		static_assert(sizeof...(Ts) > 0, "hetero_list needs at least one type");
+		static_assert(sizeof...(Ts) < 256, "hetero_list type tag is one byte long");
+
+	public:
+
+		typedef std::uint8_t tag_type;
+		typedef HeteroNode<meta::max_size<Ts...>::value, meta::max_align<Ts...>::value> node_type;
+
+		// Tag value for the given type
+		template <class U>
+		struct type_tag : std::integral_constant<tag_type, static_cast<tag_type>(meta::index_of<U, Ts...>::value)>
+		{
+			static_assert(meta::index_of<U, Ts...>::value < sizeof...(Ts), "Type is not in hetero_list's type list");
+		};
+
+	protected:
+
+		/* Internal class : [Const] Iterator */
+
+		template <bool IsConst = false>
+		class list_iterator : public std::iterator <std::forward_iterator_tag, node_type>
+		{
+			// node_type * / const node_type *
+			typedef typename std::conditional<IsConst, const node_type*, node_type*>::type node_pointer;
+
+		public:
+
+			typedef node_type value_type;
+			typedef std::ptrdiff_t difference_type;
+			typedef std::forward_iterator_tag iterator_category;
+
+			list_iterator() : ptr_{ nullptr } {};
+			explicit list_iterator(node_pointer ptr) : ptr_(ptr) {};
+
+			list_iterator(const list_iterator<IsConst>& it) : ptr_(it.ptr_) {};
+			list_iterator(const list_iterator<IsConst>&& it) : ptr_(std::move(it.ptr_)) {};
+
+			list_iterator<IsConst>& operator=(const list_iterator<IsConst>& it) = delete;
+			list_iterator<IsConst>& operator=(const list_iterator<IsConst>&& it) = delete;
+
+			bool operator==(const list_iterator<IsConst>& other) const { return ptr_ == other.ptr_; }
+			bool operator!=(const list_iterator<IsConst>& other) const { return ptr_ != other.ptr_; }
+
+			auto get_node() const -> node_pointer { return ptr_; }
+
+			// Type tag of the current element
+			auto tag() const -> tag_type { return ptr_->tag; }
+
+			template <class U>
+			auto holds() const -> bool { return ptr_->tag == type_tag<U>::value; }
+
+			// U& / const U&
+			template <class U>
+			auto get() const throw(std::invalid_argument) -> typename std::conditional<IsConst, const U&, U&>::type
+			{
+				if (!holds<U>())
+					throw std::invalid_argument("Element holds a value of another type");
+
+				return *reinterpret_cast<typename std::conditional<IsConst, const U*, U*>::type>(&ptr_->storage);
+			}
+
+			auto operator++() -> list_iterator<IsConst>&
+			{
+				ptr_ = ptr_->next;
+				return *this;
+			}
+
+			auto operator++(int) -> list_iterator<IsConst>
+			{
+				list_iterator<IsConst> it(*this);
+				this->operator++();
+				return it;
+			}
+
+		private:
+
+			node_pointer ptr_;
+		};
+
+		node_type *head, *tail;
+
+		size_t size_;
+		// Number of stored values per type (indexed by tag)
+		size_t type_size_[sizeof...(Ts)];
+
+	public:
+
+		typedef std::forward_iterator_tag iterator_category;
+
+		typedef list_iterator<false> iterator;
+		typedef list_iterator<true> const_iterator;
+
+		hetero_list();
+		~hetero_list() throw() { clear(); }
+
+		// copy ctor; move ctor; copy assign; move assign
+		hetero_list(const hetero_list& node) = delete;
+		hetero_list& operator=(const hetero_list& node) = delete;
+		hetero_list(hetero_list&& node) = delete;
+		hetero_list& operator=(hetero_list&& node) = delete;
+
+		iterator begin() const { return iterator(head); }
+		iterator end() const { return iterator(nullptr); }
+
+		const_iterator cbegin() const { return const_iterator(head); }
+		const_iterator cend() const { return const_iterator(nullptr); }
+
+		// Insert at front (stored type is the decayed type of the argument)
+		template <class U>
+		auto push_front(U&& value) -> void;
+		template <class U, class... Args>
+		auto emplace_front(Args&&... args) -> void;
+
+		// Insert at back (stored type is the decayed type of the argument)
+		template <class U>
+		auto push_back(U&& value) -> void;
+		template <class U, class... Args>
+		auto emplace_back(Args&&... args) -> void;
+
+		// Remove from the list
+		auto pop_front() throw(std::length_error) -> void;
+		auto pop_back() throw(std::length_error) -> void;
+
+		// Apply <visitor> to every element; visitor must be callable with U& for each of Ts
+		template <class Visitor>
+		auto visit(Visitor&& visitor) -> void;
+		template <class Visitor>
+		auto visit(Visitor&& visitor) const -> void;
+
+		// Apply <func> to every element of type U only
+		template <class U, class Func>
+		auto for_each_of(Func&& func) -> void;
+		template <class U, class Func>
+		auto for_each_of(Func&& func) const -> void;
+
+		// Service functions
+		inline auto size() const -> size_t { return size_; };
+		inline auto empty() const -> bool { return head == nullptr; };
+
+		// O(1) | returns count of stored values of type U
+		template <class U>
+		auto size_of() const -> size_t { return type_size_[type_tag<U>::value]; }
+
+		// Print list (every one of Ts must be printable)
+		auto print(std::ostream& ostream = std::cout) const -> std::ostream&;
+
+		// Clear container
+		auto clear() throw() -> void;
+
+	private:
+
+		// Dispatch table entries
+		template <class U, class Visitor>
+		static auto _dispatch(void* storage, Visitor& visitor) -> void { visitor(*static_cast<U*>(storage)); }
+		template <class U, class Visitor>
+		static auto _dispatch_const(const void* storage, Visitor& visitor) -> void { visitor(*static_cast<const U*>(storage)); }
+		template <class U>
+		static auto _destroy(void* storage) -> void { static_cast<U*>(storage)->~U(); }
+
+		// Visitor used by print()
+		struct _printer
+		{
+			std::ostream& stream;
+			bool is_first;
+
+			template <class U>
+			auto operator()(const U& value) -> void
+			{
+				if (!is_first)
+					stream << ",";
+
+				stream << value;
+				is_first = false;
+			}
+		};
+
+		// Allocate a node and construct a U in it; the node is freed if U's constructor throws
+		template <class U, class... Args>
+		static auto _new_node(Args&&... args) -> node_type*;
+
+		// Link node at front or back
+		auto _link_front(node_type* node) throw() -> void;
+		auto _link_back(node_type* node) throw() -> void;
+
+		// Unlink node, destroy its value and free it
+		auto _remove(node_type* node) throw() -> void;
+	};
+
+	template <class... Ts>
+	hetero_list<Ts...>::hetero_list() :
+		head{ nullptr },
+		tail{ nullptr },
+		size_{ 0 }
+	{
+		for (size_t idx = 0; idx < sizeof...(Ts); idx++)
+			type_size_[idx] = 0;
+	}
+
+	template <class... Ts>
+	template <class U, class... Args>
+	auto hetero_list<Ts...>::_new_node(Args&&... args) -> node_type*
+	{
+		std::unique_ptr<node_type> node(new node_type(type_tag<U>::value));
+		new (&node->storage) U(std::forward<Args>(args)...);
+
+		return node.release();
+	}
+
+	template <class... Ts>
+	auto hetero_list<Ts...>::_link_front(node_type* node) throw() -> void
+	{
+		node->next = head;
+
+		if (nullptr != head)
+			head->prev = node;
+		else
+			tail = node;
+
+		head = node;
+
+		size_++;
+		type_size_[node->tag]++;
+	}
+
+	template <class... Ts>
+	auto hetero_list<Ts...>::_link_back(node_type* node) throw() -> void
+	{
+		node->prev = tail;
+
+		if (nullptr != tail)
+			tail->next = node;
+		else
+			head = node;
+
+		tail = node;
+
+		size_++;
+		type_size_[node->tag]++;
+	}
+
+	template <class... Ts>
+	auto hetero_list<Ts...>::_remove(node_type* node) throw() -> void
+	{
+		typedef void(*destroy_func)(void*);
+
+		// One destructor per type, indexed by tag
+		static const destroy_func destroy_table[] = { &hetero_list<Ts...>::template _destroy<Ts>... };
+
+		if (nullptr != node->prev)
+			node->prev->next = node->next;
+		else
+			head = node->next;
+
+		if (nullptr != node->next)
+			node->next->prev = node->prev;
+		else
+			tail = node->prev;
+
+		size_--;
+		type_size_[node->tag]--;
+
+		destroy_table[node->tag](&node->storage);
+		delete node;
+	}
+
+	template <class... Ts>
+	template <class U>
+	auto hetero_list<Ts...>::push_front(U&& value) -> void
+	{
+		emplace_front<typename std::decay<U>::type>(std::forward<U>(value));
+	}
+
+	template <class... Ts>
+	template <class U, class... Args>
+	auto hetero_list<Ts...>::emplace_front(Args&&... args) -> void
+	{
+		_link_front(_new_node<U>(std::forward<Args>(args)...));
+	}
+
+	template <class... Ts>
+	template <class U>
+	auto hetero_list<Ts...>::push_back(U&& value) -> void
+	{
+		emplace_back<typename std::decay<U>::type>(std::forward<U>(value));
+	}
+
+	template <class... Ts>
+	template <class U, class... Args>
+	auto hetero_list<Ts...>::emplace_back(Args&&... args) -> void
+	{
+		_link_back(_new_node<U>(std::forward<Args>(args)...));
+	}
+
+	template <class... Ts>
+	auto hetero_list<Ts...>::pop_front() throw(std::length_error) -> void
+	{
+		if (empty())
+			throw std::length_error("list is empty");
+
+		_remove(head);
+	}
+
+	template <class... Ts>
+	auto hetero_list<Ts...>::pop_back() throw(std::length_error) -> void
+	{
+		if (empty())
+			throw std::length_error("list is empty");
+
+		_remove(tail);
+	}
+
+	template <class... Ts>
+	template <class Visitor>
+	auto hetero_list<Ts...>::visit(Visitor&& visitor) -> void
+	{
+		typedef void(*dispatch_func)(void*, Visitor&);
+
+		// One entry per type, indexed by tag
+		static const dispatch_func dispatch_table[] = { &hetero_list<Ts...>::template _dispatch<Ts, Visitor>... };
+
+		for (node_type *node = head; node != nullptr; node = node->next)
+			dispatch_table[node->tag](&node->storage, visitor);
+	}
+
+	template <class... Ts>
+	template <class Visitor>
+	auto hetero_list<Ts...>::visit(Visitor&& visitor) const -> void
+	{
+		typedef void(*dispatch_func)(const void*, Visitor&);
+
+		// One entry per type, indexed by tag
+		static const dispatch_func dispatch_table[] = { &hetero_list<Ts...>::template _dispatch_const<Ts, Visitor>... };
+
+		for (const node_type *node = head; node != nullptr; node = node->next)
+			dispatch_table[node->tag](&node->storage, visitor);
+	}
+
+	template <class... Ts>
+	template <class U, class Func>
+	auto hetero_list<Ts...>::for_each_of(Func&& func) -> void
+	{
+		size_t left = size_of<U>();
+
+		for (node_type *node = head; left > 0; node = node->next)
+		{
+			if (node->tag != type_tag<U>::value)
+				continue;
+
+			func(*reinterpret_cast<U*>(&node->storage));
+			left--;
+		}
+	}
+
+	template <class... Ts>
+	template <class U, class Func>
+	auto hetero_list<Ts...>::for_each_of(Func&& func) const -> void
+	{
+		size_t left = size_of<U>();
+
+		for (const node_type *node = head; left > 0; node = node->next)
+		{
+			if (node->tag != type_tag<U>::value)
+				continue;
+
+			func(*reinterpret_cast<const U*>(&node->storage));
+			left--;
+		}
+	}
+
+	template <class... Ts>
+	auto hetero_list<Ts...>::print(std::ostream& ostream) const -> std::ostream&
+	{
+		visit(_printer{ ostream, true });
+
+		return ostream;
+	}
+
+	template <class... Ts>
+	auto hetero_list<Ts...>::clear() throw() -> void
+	{
+		while (nullptr != head)
+			_remove(head);
+	}
+}
\ No newline at end of file
@@ -215,6 +215,9 @@ namespace hadt {
 		// Service functions
 		inline auto empty() -> bool { return begin() == end(); };
 
+		// O(n) | relinks all nodes into one contiguous block following the logical order
+		auto compact() -> void override;
+
 		// Print list
 		auto print_reverse(std::ostream& ostream = std::cout)->std::ostream& override;
 
@@ -237,13 +240,13 @@ namespace hadt {
 	template <class T>
 	auto list<T>::_push_front(T&& data) throw() -> void
 	{
-		HNode<T> *node = new HNode<T>(std::move(data));
+		HNode<T> *node = _new_node(std::move(data));
 
 		if (nullptr == tail_junk)
-			tail_junk = new HNode<T>(T{}, nullptr, nullptr);
+			tail_junk = _new_node(T{});
 
 		if (nullptr == rtail_junk)
-			rtail_junk = new HNode<T>(T{}, nullptr, nullptr);
+			rtail_junk = _new_node(T{});
 
 		// Head
 		if (nullptr != head)
@@ -273,13 +276,13 @@ namespace hadt {
 	template <class T>
 	auto list<T>::_push_back(T&& data) throw() -> void
 	{
-		HNode<T> *node = new HNode<T>(std::move(data));
+		HNode<T> *node = _new_node(std::move(data));
 
 		if (tail_junk == nullptr)
-			tail_junk = new HNode<T>(T{}, nullptr, nullptr);
+			tail_junk = _new_node(T{});
 
 		if (rtail_junk == nullptr)
-			rtail_junk = new HNode<T>(T{}, nullptr, nullptr);
+			rtail_junk = _new_node(T{});
 
 		// Tail
 		if (nullptr != tail)
@@ -326,7 +329,7 @@ namespace hadt {
 		forward_list<T>::clear();
 
 		if (nullptr != rtail_junk)
-			delete rtail_junk;
+			_delete_node(rtail_junk);
 
 		rhead = rtail = rtail_junk = nullptr;
 	}
@@ -356,7 +359,7 @@ namespace hadt {
 				head->prev = rtail_junk;
 				rtail = head;
 
-				delete tmp;
+				_delete_node(tmp);
 
 				size_--;
 			}
@@ -380,7 +383,7 @@ namespace hadt {
 				tail = prev;
 				rhead = tail;
 
-				delete tmp;
+				_delete_node(tmp);
 
 				size_--;
 			}
@@ -398,7 +401,7 @@ namespace hadt {
 			prev->next = next;
 			next->prev = prev;
 
-			delete curr;
+			_delete_node(curr);
 
 			size_--;
 		}
@@ -462,6 +465,25 @@ namespace hadt {
 			std::swap(*it_beg++, *it_end++);
 	}
 
+	template <class T>
+	auto list<T>::compact() -> void
+	{
+		if (empty()) return;
+
+		forward_list<T>::compact();
+
+		// Restore backward links
+		HNode<T> *pred = rtail_junk;
+		for (HNode<T> *curr = head; curr != tail_junk; curr = curr->next)
+		{
+			curr->prev = pred;
+			pred = curr;
+		}
+
+		rhead = tail;
+		rtail = head;
+	}
+
 	template <class T>
 	auto list<T>::reverse(list<T>& ref) -> void
 	{
@@ -0,0 +1,49 @@
+#pragma once
+
+// std::thread
+#include <thread>
+
+// std::vector
+#include <vector>
+
+// std::min, std::max
+#include <algorithm>
+
+namespace hadt {
+
+	// Number of parts [0, count) is split into: at most <threads> (0 means one per core)
+	// and at least <grain> items per part, since small batches aren't worth spawning threads for
+	inline auto parallel_parts(size_t count, unsigned threads, size_t grain = 1024) -> size_t
+	{
+		if (threads == 0)
+			threads = std::max(1u, std::thread::hardware_concurrency());
+
+		return std::max<size_t>(1, std::min<size_t>(threads, count / grain));
+	}
+
+	// Runs func(first, last, part) over [0, count) split into parallel_parts(count, threads, grain)
+	// ranges; part 0 runs on the calling thread. <func> must not throw
+	template <class Func>
+	auto parallel_for(size_t count, unsigned threads, const Func& func, size_t grain = 1024) -> void
+	{
+		auto parts = parallel_parts(count, threads, grain);
+		if (parts < 2)
+		{
+			func(size_t{ 0 }, count, 0u);
+			return;
+		}
+
+		std::vector<std::thread> pool;
+		pool.reserve(parts - 1);
+
+		for (size_t p = 1; p < parts; p++)
+			pool.emplace_back([&func, count, parts, p]() {
+				func(count * p / parts, count * (p + 1) / parts, static_cast<unsigned>(p));
+			});
+
+		func(size_t{ 0 }, count / parts, 0u);
+
+		for (auto &t : pool)
+			t.join();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,296 @@
+#pragma once
+
+// std::out_of_range, std::invalid_argument
+#include <stdexcept>
+
+// std::move, std::pair
+#include <utility>
+
+// std::vector
+#include <vector>
+
+// std::uint32_t, std::uint64_t
+#include <cstdint>
+
+// std::sort, std::unique, std::min
+#include <algorithm>
+
+#include "hadt_common.hpp"
+
+namespace hadt {
+
+	/* Reachability snapshot over the condensation of a graph (see graph_list::reachability()):
+	 *   -- every vertex id is mapped to its strongly connected component
+	 *   -- components are numbered in reverse topological order, so an edge between two
+	 *      components always leads to a lower number
+	 *   -- up to <closure_limit> components the transitive closure is kept as a bit row per
+	 *      component and a query is one bit test
+	 *   -- bigger condensations get three labels per component from one DFS over it: post-order
+	 *      rank, first rank of its DFS subtree and lowest rank it reaches. A target inside the
+	 *      source's subtree is reachable and a target outside the source's reach range isn't,
+	 *      both in O(1); other queries search the condensation, pruning every component whose
+	 *      labels exclude the target (O(V + E) of the condensation at worst, e.g. for targets
+	 *      reachable only through many cross edges)
+	 * Later changes of the graph aren't reflected, the index has to be rebuilt.
+	 */
+	class reachability_index
+	{
+	public:
+
+		typedef std::uint32_t index_type;
+
+		// Means "no such vertex/component"
+		static const index_type npos = UINT32_MAX;
+
+		static const size_t default_closure_limit = size_t{ 1 } << 13;
+
+	private:
+
+		std::vector<index_type> component_;
+		size_t component_count_;
+
+		// Condensed DAG: successors of <c> are [offsets[c], offsets[c + 1]) in targets
+		std::vector<size_t> offsets_;
+		std::vector<index_type> targets_;
+
+		// Closure rows of <words_> 64-bit words each
+		bool has_closure_;
+		size_t words_;
+		std::vector<std::uint64_t> closure_;
+
+		// Labels (only without the closure): <c> reaches ranks [reach_low_[c], post_[c]],
+		// its DFS subtree holds exactly the ranks [tree_low_[c], post_[c]]
+		std::vector<index_type> post_;
+		std::vector<index_type> tree_low_;
+		std::vector<index_type> reach_low_;
+
+		// Every component reachable from <from> has its rank inside the subtree range
+		inline auto _in_subtree(index_type from, index_type to) const -> bool
+		{
+			return tree_low_[from] <= post_[to] && post_[to] <= post_[from];
+		}
+
+		// False only if <to> is surely unreachable from <from>
+		inline auto _may_reach(index_type from, index_type to) const -> bool
+		{
+			return reach_low_[from] <= reach_low_[to] && post_[to] <= post_[from];
+		}
+
+		// O(V + E) of the condensation | one DFS assigns the labels
+		auto _label() -> void
+		{
+			const index_type unvisited = npos;
+			const index_type entered = npos - 1;
+
+			post_.assign(component_count_, unvisited);
+			tree_low_.assign(component_count_, 0);
+			reach_low_.assign(component_count_, 0);
+
+			index_type rank{};
+			std::vector<std::pair<index_type, size_t>> v_list;
+
+			// Sources are numbered highest; starting there keeps the trees big
+			for (auto root = component_count_; root-- > 0;)
+			{
+				if (post_[root] != unvisited)
+					continue;
+
+				// Ranks of the subtree start with the first one given out below <root>
+				post_[root] = entered;
+				tree_low_[root] = rank;
+				v_list.push_back(std::make_pair(static_cast<index_type>(root), offsets_[root]));
+
+				while (!v_list.empty())
+				{
+					auto& top = v_list.back();
+
+					if (top.second < offsets_[top.first + 1])
+					{
+						auto succ = targets_[top.second++];
+						if (post_[succ] != unvisited)
+							continue;
+
+						post_[succ] = entered;
+						tree_low_[succ] = rank;
+						v_list.push_back(std::make_pair(succ, offsets_[succ]));
+					}
+					else
+					{
+						post_[top.first] = rank++;
+						v_list.pop_back();
+					}
+				}
+			}
+
+			// Successors are numbered lower, so their ranges are complete by the time they're merged
+			for (size_t c = 0; c < component_count_; c++)
+			{
+				reach_low_[c] = tree_low_[c];
+				for (auto e = offsets_[c]; e < offsets_[c + 1]; e++)
+					reach_low_[c] = std::min(reach_low_[c], reach_low_[targets_[e]]);
+			}
+		}
+
+	public:
+
+		reachability_index() : component_count_{ 0 }, offsets_(1, 0), has_closure_{ false }, words_{ 0 } {};
+
+		// <component> maps vertex ids to components (npos for unused ids); <edges> are (from, to)
+		// component pairs of the inter-component edges in any order, repeats included
+		reachability_index(std::vector<index_type>&& component, size_t component_count,
+			std::vector<std::pair<index_type, index_type>>&& edges, size_t closure_limit = default_closure_limit) :
+			component_(std::move(component)),
+			component_count_{ component_count },
+			offsets_(component_count + 1, 0),
+			has_closure_{ component_count <= closure_limit },
+			words_{ (component_count + 63) / 64 }
+		{
+			std::sort(edges.begin(), edges.end());
+			edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+
+			targets_.reserve(edges.size());
+			for (auto& edge : edges)
+			{
+				offsets_[edge.first + 1]++;
+				targets_.push_back(edge.second);
+			}
+
+			for (size_t c = 0; c < component_count_; c++)
+				offsets_[c + 1] += offsets_[c];
+
+			if (!has_closure_)
+			{
+				_label();
+				return;
+			}
+
+			// Successors are numbered lower, so their rows are complete by the time they're merged
+			closure_.assign(component_count_ * words_, 0);
+			for (size_t c = 0; c < component_count_; c++)
+			{
+				auto row = &closure_[c * words_];
+				row[c / 64] |= std::uint64_t{ 1 } << (c % 64);
+
+				for (auto e = offsets_[c]; e < offsets_[c + 1]; e++)
+				{
+					auto succ = &closure_[targets_[e] * words_];
+					for (size_t w = 0; w < words_; w++)
+						row[w] |= succ[w];
+				}
+			}
+		}
+
+		// copy ctor; copy assign
+		reachability_index(const reachability_index& index) = delete;
+		reachability_index& operator=(const reachability_index& index) = delete;
+
+		// move ctor; move assign
+		reachability_index(reachability_index&& index) :
+			component_(std::move(index.component_)),
+			component_count_{ index.component_count_ },
+			offsets_(std::move(index.offsets_)),
+			targets_(std::move(index.targets_)),
+			has_closure_{ index.has_closure_ },
+			words_{ index.words_ },
+			closure_(std::move(index.closure_)),
+			post_(std::move(index.post_)),
+			tree_low_(std::move(index.tree_low_)),
+			reach_low_(std::move(index.reach_low_)) {};
+
+		reachability_index& operator=(reachability_index&& index)
+		{
+			component_ = std::move(index.component_);
+			component_count_ = index.component_count_;
+			offsets_ = std::move(index.offsets_);
+			targets_ = std::move(index.targets_);
+			has_closure_ = index.has_closure_;
+			words_ = index.words_;
+			closure_ = std::move(index.closure_);
+			post_ = std::move(index.post_);
+			tree_low_ = std::move(index.tree_low_);
+			reach_low_ = std::move(index.reach_low_);
+
+			return *this;
+		}
+
+		// O(1) | number of strongly connected components
+		inline auto component_count() const -> size_t { return component_count_; };
+		// O(1) | whether queries are answered from the closure bits
+		inline auto has_closure() const -> bool { return has_closure_; };
+
+		// O(1) | component of a vertex id
+		auto component_of(size_t id) const throw(std::out_of_range) -> index_type
+		{
+			if (id >= component_.size() || component_[id] == npos)
+				throw std::out_of_range("Unknown vertex id");
+
+			return component_[id];
+		}
+
+		// O(1) with the closure or when the labels decide, otherwise O(V + E) of the condensation at worst
+		auto reachable(size_t from_id, size_t to_id) const throw(std::out_of_range) -> bool
+		{
+			visited_marks marks;
+
+			return reachable(from_id, to_id, marks);
+		}
+
+		// Same, keeping the search state in <marks> (only used when the labels don't decide)
+		auto reachable(size_t from_id, size_t to_id, visited_marks& marks) const throw(std::out_of_range) -> bool
+		{
+			auto from = component_of(from_id);
+			auto to = component_of(to_id);
+
+			if (from == to)
+				return true;
+
+			// Edges only lead to lower components
+			if (from < to)
+				return false;
+
+			if (has_closure_)
+				return (closure_[from * words_ + to / 64] >> (to % 64) & 1) != 0;
+
+			if (!_may_reach(from, to))
+				return false;
+
+			if (_in_subtree(from, to))
+				return true;
+
+			marks.reset(component_count_);
+			marks.mark(from);
+
+			std::vector<index_type> pending(1, from);
+			while (!pending.empty())
+			{
+				auto c = pending.back();
+				pending.pop_back();
+
+				for (auto e = offsets_[c]; e < offsets_[c + 1]; e++)
+				{
+					auto succ = targets_[e];
+					if (succ < to || !_may_reach(succ, to))
+						continue;
+
+					if (_in_subtree(succ, to))
+						return true;
+
+					if (marks.test_and_mark(succ))
+						pending.push_back(succ);
+				}
+			}
+
+			return false;
+		}
+
+		// Same for vertex nodes
+		template <class Node>
+		auto reachable(const Node* from, const Node* to) const throw(std::invalid_argument, std::out_of_range) -> bool
+		{
+			if (from == nullptr || to == nullptr)
+				throw std::invalid_argument("Vertex node can't be null");
+
+			return reachable(from->id, to->id);
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,116 @@
+#pragma once
+
+// std::aligned_storage, std::alignment_of
+#include <type_traits>
+
+// std::move
+#include <utility>
+
+// placement new
+#include <new>
+
+#include "hadt_common.hpp"
+
+// hadt::list
+#include "./hadt_list.hpp"
+
+namespace hadt {
+
+	/* Doubly-linked list with a small-buffer optimization:
+	 *   -- the first K element nodes (plus both sentinels) live inside the container object
+	 *   -- nodes beyond that are allocated on the heap as usual
+	 * Nodes are plain HNode<T>, so iterators don't know (and don't care) where a node lives
+	 */
+	template <class T, size_t K = 8>
+	class small_list : public list<T>
+	{
+		typedef typename std::aligned_storage<sizeof(HNode<T>), std::alignment_of<HNode<T>>::value>::type node_storage;
+
+		// K element nodes + tail_junk + rtail_junk
+		static const size_t inline_capacity = K + 2;
+
+		node_storage inline_nodes[inline_capacity];
+
+		// Intrusive list of unused inline slots (a free slot stores the pointer to the next one)
+		void *inline_free;
+		size_t inline_size_;
+
+	public:
+
+		small_list();
+		~small_list() throw() { list<T>::clear(); }
+
+		// copy ctor; move ctor; copy assign; move assign
+		small_list(const small_list& node) = delete;
+		small_list& operator=(const small_list& node) = delete;
+		small_list(small_list&& node) = delete;
+		small_list& operator=(small_list&& node) = delete;
+
+		// O(1) | returns count of nodes (sentinels included) placed in inline storage
+		inline auto inline_size() const -> size_t { return inline_size_; };
+		// O(1) | returns max count of nodes (sentinels included) inline storage can hold
+		inline auto inline_max_size() const -> size_t { return inline_capacity; };
+
+		// O(1) | checks whether the given node lives in inline storage
+		auto is_inline(const HNode<T>* node) const -> bool;
+
+	private:
+
+		auto _new_node(T&& data) -> HNode<T>* override;
+		auto _delete_node(HNode<T>* node) throw() -> void override;
+	};
+
+	template <class T, size_t K>
+	small_list<T, K>::small_list() :
+		inline_free{ nullptr },
+		inline_size_{ 0 }
+	{
+		// Chain all inline slots into the free list (first slot ends up on top)
+		for (size_t i = inline_capacity; i > 0; i--)
+		{
+			void *slot = &inline_nodes[i - 1];
+			*static_cast<void**>(slot) = inline_free;
+			inline_free = slot;
+		}
+	}
+
+	template <class T, size_t K>
+	auto small_list<T, K>::is_inline(const HNode<T>* node) const -> bool
+	{
+		const void *ptr = node;
+
+		return ptr >= static_cast<const void*>(&inline_nodes[0]) &&
+			ptr < static_cast<const void*>(&inline_nodes[inline_capacity]);
+	}
+
+	template <class T, size_t K>
+	auto small_list<T, K>::_new_node(T&& data) -> HNode<T>*
+	{
+		// Spill to the heap
+		if (nullptr == inline_free)
+			return list<T>::_new_node(std::move(data));
+
+		void *slot = inline_free;
+		inline_free = *static_cast<void**>(slot);
+		inline_size_++;
+
+		return new (slot) HNode<T>(std::move(data));
+	}
+
+	template <class T, size_t K>
+	auto small_list<T, K>::_delete_node(HNode<T>* node) throw() -> void
+	{
+		if (!is_inline(node))
+		{
+			list<T>::_delete_node(node);
+			return;
+		}
+
+		node->~HNode<T>();
+
+		void *slot = node;
+		*static_cast<void**>(slot) = inline_free;
+		inline_free = slot;
+		inline_size_--;
+	}
+}
\ No newline at end of file
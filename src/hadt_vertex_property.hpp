@@ -0,0 +1,83 @@
+#pragma once
+
+// std::out_of_range
+#include <stdexcept>
+
+// std::vector
+#include <vector>
+
+// std::fill
+#include <algorithm>
+
+// std::is_same
+#include <type_traits>
+
+namespace hadt {
+
+	/* Internal class : type-erased property column, as kept by a graph */
+	class vertex_property_base
+	{
+	public:
+
+		virtual ~vertex_property_base() {};
+
+		// Makes the slot of <id> exist and hold the initial value
+		virtual auto prepare(size_t id) -> void = 0;
+	};
+
+	/* Per-vertex attribute kept in one contiguous array indexed by VertexNode::id
+	 * (see graph_list::add_vertex_property). A slot is reset to the initial value when
+	 * its id is given to a new vertex; the array is reallocated only when the id bound grows.
+	 */
+	template <class U>
+	class vertex_property : public vertex_property_base
+	{
+		static_assert(!std::is_same<U, bool>::value, "std::vector<bool> isn't contiguous, use char or std::uint8_t instead");
+
+	private:
+
+		std::vector<U> values;
+		U initial;
+
+	public:
+
+		vertex_property(size_t id_bound, const U& initial_value) : values(id_bound, initial_value), initial(initial_value) {};
+
+		// copy ctor; copy assign
+		vertex_property(const vertex_property& property) = delete;
+		vertex_property& operator=(const vertex_property& property) = delete;
+
+		auto prepare(size_t id) -> void override
+		{
+			if (id < values.size())
+				values[id] = initial;
+			else
+				values.resize(id + 1, initial);
+		}
+
+		// O(1) | value by vertex id or by vertex node
+		inline auto operator[](size_t id) -> U& { return values[id]; };
+		inline auto operator[](size_t id) const -> const U& { return values[id]; };
+
+		template <class Node>
+		inline auto operator[](const Node* node) -> U& { return values[node->id]; };
+		template <class Node>
+		inline auto operator[](const Node* node) const -> const U& { return values[node->id]; };
+
+		auto at(size_t id) throw(std::out_of_range) -> U&
+		{
+			if (id >= values.size())
+				throw std::out_of_range("Vertex id is out of range");
+
+			return values[id];
+		}
+
+		// Raw array of size() values
+		inline auto data() -> U* { return values.data(); };
+		inline auto data() const -> const U* { return values.data(); };
+		inline auto size() const -> size_t { return values.size(); };
+
+		// O(n) | sets every slot (removed vertices' ones included) to <value>
+		auto fill(const U& value) -> void { std::fill(values.begin(), values.end(), value); };
+	};
+}
\ No newline at end of file
@@ -3,22 +3,35 @@
 
 #include <vector>
 #include <list>
+#include <fstream>
+#include <cstdio>
+#include <cstring>
+#include <thread>
 
 #include "../src/hadt_list.hpp"
 #include "../src/hadt_forward_list.hpp"
 #include "../src/hadt_graph_list.hpp"
+#include "../src/hadt_small_list.hpp"
+#include "../src/hadt_compact_list.hpp"
+#include "../src/hadt_hetero_list.hpp"
 
 #include "../modules/catch/single_include/catch.hpp"
 
 using hadt::list;
 using hadt::forward_list;
 using hadt::graph_list;
+using hadt::small_list;
+using hadt::compact_list;
+using hadt::hetero_list;
 
 /*
 	Aliases:
 		-- SLL -> Singly-Linked List
 		-- DLL -> Doubly-Linked List
 		-- GAL -> Graph Adjacent List
+		-- SBL -> Small-Buffer (Doubly-Linked) List
+		-- CL  -> Compact (Index-Linked) List
+		-- HL  -> Heterogeneous List
 */
 
 TEST_CASE("List Creation: ", "[Methods][Construction][SLL][DLL][GAL]")
@@ -1061,4 +1074,1913 @@ TEST_CASE("Iterate over graph paths", "[Methods][DFS][GAL]")
 	});
 
 	auto it = 0;
-}
\ No newline at end of file
+}
+
+TEST_CASE("Small-buffer list storage", "[Methods][Construction][SBL]")
+{
+	// 4 element nodes + 2 sentinels fit into inline storage
+	small_list<int, 4> sblist;
+
+	REQUIRE(sblist.empty());
+	REQUIRE(sblist.inline_size() == 0);
+	REQUIRE(sblist.inline_max_size() == 6);
+
+	sblist.fill_with({ 1, 2, 3, 4 });
+	REQUIRE(sblist.size() == 4);
+	REQUIRE(sblist.inline_size() == 6);
+	REQUIRE(sblist.is_inline(sblist.begin().get_node()));
+	REQUIRE(sblist.is_inline(sblist.rbegin().get_node()));
+
+	// Spill to the heap
+	sblist.push_back(5);
+	sblist.push_front(0);
+	REQUIRE(sblist.size() == 6);
+	REQUIRE(sblist.inline_size() == 6);
+	REQUIRE_FALSE(sblist.is_inline(sblist.begin().get_node()));
+	REQUIRE_FALSE(sblist.is_inline(sblist.rbegin().get_node()));
+
+	std::ostringstream str_stream;
+	sblist.print(str_stream);
+	REQUIRE(str_stream.str() == std::string("0,1,2,3,4,5"));
+
+	str_stream.str("");
+	str_stream.clear();
+	sblist.print_reverse(str_stream);
+	REQUIRE(str_stream.str() == std::string("5,4,3,2,1,0"));
+
+	// Inline slots are reused after removal
+	REQUIRE(sblist.pop_at(2) == 2);
+	REQUIRE(sblist.inline_size() == 5);
+	sblist.push_back(6);
+	REQUIRE(sblist.inline_size() == 6);
+	REQUIRE(sblist.is_inline(sblist.rbegin().get_node()));
+	REQUIRE(sblist.at_back() == 6);
+
+	sblist.clear();
+	REQUIRE(sblist.empty());
+	REQUIRE(sblist.inline_size() == 0);
+
+	sblist.fill_with({ 7, 8 });
+	REQUIRE(sblist.size() == 2);
+	REQUIRE(sblist.inline_size() == 4);
+}
+
+TEST_CASE("Compacting nodes into a contiguous block", "[Methods][Compact][SLL][DLL][GAL]")
+{
+	SECTION("for SLL")
+	{
+		forward_list<int> slist;
+
+		slist.fill_with({ 3, 4, 5 });
+		slist.push_front(2);
+		slist.push_back(6);
+		slist.push_front(1);
+		slist.pop_at(3);
+
+		// Sequence is: 1 -> 2 -> 3 -> 5 -> 6
+		slist.compact();
+		REQUIRE(slist.size() == 5);
+
+		auto it = slist.begin();
+		auto node = it.get_node();
+		for (size_t idx = 0; idx < slist.size(); idx++)
+			REQUIRE((it++).get_node() == node + idx);
+
+		std::ostringstream str_stream;
+		slist.print(str_stream);
+		REQUIRE(str_stream.str() == std::string("1,2,3,5,6"));
+
+		// Mixing block nodes and heap nodes
+		slist.push_back(7);
+		REQUIRE(slist.pop_front() == 1);
+		REQUIRE(slist.pop_back() == 7);
+		REQUIRE(slist.pop_at(1) == 3);
+		REQUIRE(slist.at_back() == 6);
+
+		slist.compact();
+		REQUIRE(slist.size() == 3);
+		REQUIRE(slist.at_front() == 2);
+		REQUIRE(slist.at_back() == 6);
+
+		slist.clear();
+		REQUIRE(slist.empty());
+		slist.compact();
+		REQUIRE(slist.empty());
+	}
+
+	SECTION("for DLL")
+	{
+		list<int> dlist;
+
+		dlist.fill_with({ 2, 3 });
+		dlist.push_front(1);
+		dlist.push_back(4);
+
+		dlist.compact();
+		REQUIRE(dlist.size() == 4);
+		REQUIRE(dlist.find_nth_to_last(0).get_node() == dlist.begin().get_node() + 3);
+
+		std::ostringstream str_stream;
+		dlist.print_reverse(str_stream);
+		REQUIRE(str_stream.str() == std::string("4,3,2,1"));
+
+		dlist.push_front(0);
+		REQUIRE(dlist.pop_back() == 4);
+		REQUIRE(*dlist.rbegin() == 3);
+		REQUIRE(*dlist.begin() == 0);
+	}
+
+	SECTION("for GAL")
+	{
+		graph_list<std::string, int> glist;
+
+		glist.add_vertices({ "A", "B", "C", "D" });
+		glist.add_edges(
+		{
+			std::make_tuple(1, "A", "B"),
+			std::make_tuple(2, "A", "C"),
+			std::make_tuple(3, "B", "D"),
+			std::make_tuple(4, "C", "D"),
+			std::make_tuple(5, "D", "A")
+		});
+
+		glist.compact();
+		REQUIRE(glist.size() == 4);
+		REQUIRE(glist.edge_size("A") == 2);
+		REQUIRE(glist.edge_size("D") == 1);
+
+		auto vit = glist.begin();
+		auto node = vit.get_node();
+		for (size_t idx = 0; idx < glist.size(); idx++)
+			REQUIRE((vit++).get_node() == node + idx);
+
+		std::string result;
+		std::ostringstream stream;
+		glist.bfs_vertex_map([&stream](std::string& next) {
+			stream << next << "-";
+		});
+		result = stream.str();
+		REQUIRE(result.substr(0, result.size() - 1) == "A-B-C-D");
+
+		int acc{};
+		glist.edge_fold<int>(acc, "A", [](int next) { return next; });
+		REQUIRE(acc == 3);
+
+		glist.remove_vertex(node + 1);
+		REQUIRE(glist.size() == 3);
+		REQUIRE(glist.edge_size("A") == 1);
+		REQUIRE(glist.edge_size("C") == 1);
+
+		glist.add_vertex("E");
+		glist.add_edge(6, "C", "E");
+		glist.compact();
+		REQUIRE(glist.edge_size("C") == 2);
+		REQUIRE(glist.edge_size("E") == 0);
+
+		glist.clear();
+		REQUIRE(glist.empty());
+	}
+}
+
+TEST_CASE("Index-linked compact list", "[Methods][Iterators][Reverse][CL]")
+{
+	compact_list<int> clist;
+
+	REQUIRE(clist.empty());
+	REQUIRE(clist.begin() == clist.end());
+	REQUIRE(clist.rbegin() == clist.rend());
+	REQUIRE_THROWS_AS(clist.pop_front(), std::length_error);
+
+	clist.fill_with({ 3, 5, 7 });
+	clist.push_front(1);
+	clist.push_back(11);
+	REQUIRE(clist.size() == 5);
+
+	// Sequence is: 1 -> 3 -> 5 -> 7 -> 11
+	auto it = clist.begin();
+	REQUIRE(*it++ == 1);
+	REQUIRE(*it++ == 3);
+	REQUIRE(*it++ == 5);
+	REQUIRE(*it++ == 7);
+	REQUIRE(*it++ == 11);
+	REQUIRE(it == clist.end());
+
+	auto rit = clist.rcbegin();
+	REQUIRE(*rit++ == 11);
+	REQUIRE(*rit++ == 7);
+	REQUIRE(*--rit == 7);
+
+	REQUIRE(clist.at(3) == 7);
+	REQUIRE(clist.at_back() == 11);
+	REQUIRE(*clist.find_first(5) == 5);
+	REQUIRE(clist.find_first(50) == clist.end());
+	REQUIRE(*clist.find_nth_to_last(1) == 7);
+	REQUIRE_THROWS_AS(clist.at(100), std::out_of_range);
+
+	// Freed slots are reused before the pool grows
+	REQUIRE(clist.pop_at(2) == 5);
+	REQUIRE(clist.pop_front() == 1);
+	REQUIRE(clist.pop_back() == 11);
+	auto capacity = clist.capacity();
+	clist.push_back(13);
+	clist.push_back(17);
+	REQUIRE(clist.capacity() == capacity);
+
+	std::ostringstream str_stream;
+	clist.print(str_stream);
+	REQUIRE(str_stream.str() == std::string("3,7,13,17"));
+
+	clist.reverse_inplace();
+	str_stream.str("");
+	str_stream.clear();
+	clist.print(str_stream);
+	REQUIRE(str_stream.str() == std::string("17,13,7,3"));
+
+	str_stream.str("");
+	str_stream.clear();
+	clist.print_reverse(str_stream);
+	REQUIRE(str_stream.str() == std::string("3,7,13,17"));
+
+	compact_list<int> clist_reversed;
+	clist.reverse(clist_reversed);
+	REQUIRE(clist_reversed.size() == 4);
+	REQUIRE(clist_reversed.at_front() == 3);
+	REQUIRE(clist_reversed.at_back() == 17);
+
+	clist.clear();
+	REQUIRE(clist.empty());
+	REQUIRE(clist.begin() == clist.end());
+
+	// Nodes are relocated as the pool grows
+	compact_list<std::string> slist;
+	for (int idx = 0; idx < 100; idx++)
+		slist.move_back(std::to_string(idx));
+
+	REQUIRE(slist.size() == 100);
+	REQUIRE(slist.at(42) == "42");
+	REQUIRE(slist.at_back() == "99");
+}
+
+TEST_CASE("Heterogeneous list", "[Methods][Iterators][HL]")
+{
+	hetero_list<int, double, std::string> hlist;
+
+	REQUIRE(hlist.empty());
+	REQUIRE(hlist.begin() == hlist.end());
+	REQUIRE_THROWS_AS(hlist.pop_front(), std::length_error);
+
+	hlist.push_back(1);
+	hlist.push_back(std::string{ "two" });
+	hlist.push_back(3.5);
+	hlist.emplace_back<std::string>(3, 'x');
+	hlist.push_front(0);
+
+	// Sequence is: 0 -> 1 -> "two" -> 3.5 -> "xxx"
+	REQUIRE(hlist.size() == 5);
+	REQUIRE(hlist.size_of<int>() == 2);
+	REQUIRE(hlist.size_of<double>() == 1);
+	REQUIRE(hlist.size_of<std::string>() == 2);
+
+	std::ostringstream str_stream;
+	hlist.print(str_stream);
+	REQUIRE(str_stream.str() == std::string("0,1,two,3.5,xxx"));
+
+	SECTION("... typed iteration")
+	{
+		auto it = hlist.begin();
+		REQUIRE(it.holds<int>());
+		REQUIRE(it.get<int>() == 0);
+		REQUIRE_THROWS_AS(it.get<double>(), std::invalid_argument);
+
+		it++;
+		it++;
+		REQUIRE(it.tag() == hetero_list<int, double, std::string>::type_tag<std::string>::value);
+		it.get<std::string>() += "!";
+
+		int int_sum{};
+		hlist.for_each_of<int>([&int_sum](int& next) { int_sum += next; });
+		REQUIRE(int_sum == 1);
+
+		std::string str_acc{};
+		hlist.for_each_of<std::string>([&str_acc](const std::string& next) { str_acc += next + ";"; });
+		REQUIRE(str_acc == "two!;xxx;");
+	}
+
+	SECTION("... visiting")
+	{
+		struct doubler
+		{
+			void operator()(int& value) { value *= 2; }
+			void operator()(double& value) { value *= 2; }
+			void operator()(std::string& value) { value += value; }
+		};
+
+		hlist.visit(doubler{});
+
+		str_stream.str("");
+		str_stream.clear();
+		hlist.print(str_stream);
+		REQUIRE(str_stream.str() == std::string("0,2,twotwo,7,xxxxxx"));
+	}
+
+	SECTION("... removing")
+	{
+		hlist.pop_front();
+		hlist.pop_back();
+		REQUIRE(hlist.size() == 3);
+		REQUIRE(hlist.size_of<int>() == 1);
+		REQUIRE(hlist.size_of<std::string>() == 1);
+
+		hlist.clear();
+		REQUIRE(hlist.empty());
+		REQUIRE(hlist.size_of<double>() == 0);
+	}
+
+	SECTION("... failing construction")
+	{
+		// std::string throws before the node is linked; the node must not leak
+		REQUIRE_THROWS_AS(hlist.emplace_back<std::string>(std::string::npos, 'x'), std::length_error);
+		REQUIRE_THROWS_AS(hlist.emplace_front<std::string>(std::string::npos, 'x'), std::length_error);
+		REQUIRE(hlist.size() == 5);
+		REQUIRE(hlist.size_of<std::string>() == 2);
+	}
+}
+
+TEST_CASE("Frozen CSR snapshot", "[Methods][BFS][DFS][GAL][CSR]")
+{
+	/*	  ______A______
+		  |     |     |
+		  B     C     D
+		  |     |     |
+		 _E_    I     H
+		|   |   |
+		F   G   J
+	*/
+
+	graph_list<std::string, int> glist;
+	glist.add_vertices(
+	{
+		"A", "B", "C", "D", "E", "F", "G", "H", "I", "J"
+	});
+
+	using hadt::make_edge;
+	glist.add_edges(
+	{
+		make_edge(1, "A", "B"),
+		make_edge(2, "A", "C"),
+		make_edge(3, "A", "D"),
+		make_edge(4, "B", "E"),
+		make_edge(5, "C", "I"),
+		make_edge(6, "D", "H"),
+		make_edge(7, "E", "F"),
+		make_edge(8, "E", "G"),
+		make_edge(9, "I", "J")
+	});
+
+	auto csr = glist.freeze();
+	REQUIRE(csr.size() == 10);
+	REQUIRE(csr.edge_count() == 9);
+	REQUIRE(csr.edge_size(0) == 3);
+	REQUIRE(csr.vertex_data(4) == "E");
+	REQUIRE(csr.find_vertex("I") == 8);
+	REQUIRE(csr.find_vertex("Z") == hadt::graph_csr<std::string, int>::npos);
+	REQUIRE_THROWS_AS(csr.edge_size(10), std::out_of_range);
+
+	std::string result;
+	std::ostringstream stream;
+
+	auto lambda = [&stream](std::string& next) {
+		stream << next << "-";
+	};
+
+	csr.bfs_vertex_map(lambda);
+	result = stream.str();
+	REQUIRE(result.substr(0, result.size() - 1) == "A-B-C-D-E-I-H-F-G-J");
+
+	stream.str("");
+	stream.clear();
+	csr.dfs_vertex_map(lambda);
+	result = stream.str();
+	REQUIRE(result.substr(0, result.size() - 1) == "A-B-E-F-G-C-I-J-D-H");
+
+	stream.str("");
+	stream.clear();
+	csr.bfs_vertex_map(lambda, csr.find_vertex("C"));
+	result = stream.str();
+	REQUIRE(result.substr(0, result.size() - 1) == "C-I-J");
+
+	int acc{};
+	csr.edge_fold<int>(acc, 0, [](int next) { return next; });
+	REQUIRE(acc == 6);
+
+	csr.edge_map(0, [](int& next) { next *= 10; });
+	acc = 0;
+	csr.edge_fold<int>(acc, 0, [](int next) { return next; });
+	REQUIRE(acc == 60);
+
+	std::string str_acc{};
+	csr.vertex_fold<std::string>(str_acc, [](std::string next) { return next; });
+	REQUIRE(str_acc == "ABCDEFGHIJ");
+
+	// Snapshot doesn't follow the staging graph
+	glist.add_vertex("K");
+	REQUIRE(csr.size() == 10);
+}
+
+TEST_CASE("Edge tail tracking & batch edges", "[Methods][Construction][GAL]")
+{
+	graph_list<char, int> glist;
+
+	auto node_a = glist.add_vertex('A');
+	auto node_b = glist.add_vertex('B');
+	auto node_c = glist.add_vertex('C');
+	auto node_d = glist.add_vertex('D');
+
+	glist.add_edges_from(node_a, { std::make_pair(1, node_b), std::make_pair(2, node_c) });
+	glist.add_edge(3, node_a, node_d);
+	REQUIRE(glist.edge_size(node_a) == 3);
+
+	std::vector<std::pair<int, hadt::VertexNode<char, int>*>> batch{ { 4, node_a }, { 5, node_c } };
+	glist.add_edges_from(node_b, batch.begin(), batch.end());
+	REQUIRE(glist.edge_size(node_b) == 2);
+
+	// Removing the last edge moves the tail back
+	glist.remove_egde(node_a, node_d);
+	REQUIRE(glist.edge_size(node_a) == 2);
+	glist.add_edge(6, node_a, node_b);
+
+	auto eit = glist.edge_begin(node_a);
+	REQUIRE(*eit++ == 1);
+	REQUIRE(*eit++ == 2);
+	REQUIRE(*eit++ == 6);
+	REQUIRE(eit == glist.edge_end());
+
+	// Removing the only edge resets the tail
+	glist.remove_egde(node_b, node_a);
+	glist.remove_egde(node_b, node_c);
+	REQUIRE(glist.edge_size(node_b) == 0);
+	glist.add_edge(7, node_b, node_d);
+	REQUIRE(glist.edge_size(node_b) == 1);
+	REQUIRE(*glist.edge_begin(node_b) == 7);
+
+	glist.compact();
+	glist.add_edge(8, 'A', 'C');
+	REQUIRE(glist.edge_size('A') == 4);
+
+	int acc{};
+	glist.edge_fold<int>(acc, 'A', [](int next) { return next; });
+	REQUIRE(acc == 17);
+
+	REQUIRE_THROWS_AS(glist.add_edges_from(nullptr, { std::make_pair(1, node_b) }), std::invalid_argument);
+
+	// A null target in the middle of a batch is rejected before any edge is built
+	auto vit = glist.begin();
+	auto vertex_a = vit.get_node();
+	vit++;
+	auto vertex_b = vit.get_node();
+
+	std::vector<std::pair<int, hadt::VertexNode<char, int>*>> broken{ { 9, vertex_b }, { 10, nullptr }, { 11, vertex_b } };
+	REQUIRE_THROWS_AS(glist.add_edges_from(vertex_a, broken.begin(), broken.end()), std::invalid_argument);
+	REQUIRE(glist.edge_size(vertex_a) == 4);
+}
+
+TEST_CASE("Vertex hash index", "[Methods][Search][GAL]")
+{
+	graph_list<std::string, int> glist;
+
+	glist.add_vertices({ "A", "B", "C" });
+	REQUIRE_FALSE(glist.has_vertex_index());
+
+	glist.enable_vertex_index();
+	REQUIRE(glist.has_vertex_index());
+
+	// Vertices added after the index is built
+	glist.add_vertices({ "D", "B" });
+
+	using hadt::make_edge;
+	glist.add_edges(
+	{
+		make_edge(1, "A", "B"),
+		make_edge(2, "A", "D"),
+		make_edge(3, "B", "C"),
+		make_edge(4, "D", "A")
+	});
+
+	REQUIRE(glist.edge_size("A") == 2);
+	REQUIRE(glist.edge_size("B") == 1);
+	REQUIRE_THROWS_AS(glist.edge_size("Z"), std::invalid_argument);
+
+	// Duplicate payload: the first vertex wins, the second one takes over after removal
+	auto first_b = glist.begin();
+	first_b++;
+	glist.remove_vertex(first_b.get_node());
+	REQUIRE(glist.size() == 4);
+	REQUIRE(glist.edge_size("B") == 0);
+	REQUIRE(glist.edge_size("A") == 1);
+
+	glist.remove_vertex(glist.begin().get_node());
+	REQUIRE_THROWS_AS(glist.edge_size("A"), std::invalid_argument);
+
+	// Index follows relocated vertices
+	glist.compact();
+	glist.add_edge(5, "C", "D");
+	REQUIRE(glist.edge_size("C") == 1);
+
+	glist.clear();
+	REQUIRE_THROWS_AS(glist.edge_size("C"), std::invalid_argument);
+	glist.add_vertices({ "X", "Y" });
+	glist.add_edge(6, "X", "Y");
+	REQUIRE(glist.edge_size("X") == 1);
+
+	// Mapped payloads are indexed again, so a removal finds their entries
+	glist.add_vertex("Z");
+	glist.add_edge(7, "Y", "Z");
+	glist.vertex_map([](std::string& v) { v += "1"; });
+	glist.bfs_vertex_map([](std::string& v) { v += "2"; });
+	glist.remove_vertex(glist.begin().get_node());
+	REQUIRE_THROWS_AS(glist.edge_size("Y"), std::invalid_argument);
+	REQUIRE(glist.edge_size("Y12") == 1);
+
+	// Written behind the index: refused until the index is rebuilt
+	*glist.begin() = "W";
+	REQUIRE_THROWS_AS(glist.remove_vertex(glist.begin().get_node()), std::logic_error);
+	REQUIRE(glist.size() == 2);
+	glist.enable_vertex_index();
+	glist.remove_vertex(glist.begin().get_node());
+	REQUIRE(glist.edge_size("Z12") == 0);
+
+	glist.disable_vertex_index();
+	REQUIRE(glist.edge_size("Z12") == 0);
+}
+
+TEST_CASE("Reverse adjacency", "[Methods][GAL]")
+{
+	graph_list<int, int> glist;
+
+	auto v1 = glist.add_vertex(1);
+	auto v2 = glist.add_vertex(2);
+	auto v3 = glist.add_vertex(3);
+	auto v4 = glist.add_vertex(4);
+
+	glist.add_edge(10, v1, v2);
+	glist.add_edge(11, v1, v2);
+	glist.add_edge(12, v3, v2);
+	glist.add_edge(13, v2, v2);
+	glist.add_edge(14, v2, v4);
+
+	REQUIRE_THROWS_AS(glist.in_edge_size(v2), std::logic_error);
+
+	glist.enable_in_edges();
+	REQUIRE(glist.has_in_edges());
+	REQUIRE(glist.in_edge_size(v2) == 4);
+	REQUIRE(glist.in_edge_size(v4) == 1);
+	REQUIRE_THROWS_AS(glist.in_edge_size(nullptr), std::invalid_argument);
+
+	glist.add_edges_from(v4, { std::make_pair(15, v1) });
+	REQUIRE(glist.in_edge_size(v1) == 1);
+
+	glist.remove_egde(v1, v2);
+	REQUIRE(glist.in_edge_size(v2) == 3);
+
+	// Edges to v2 in the middle of v3's list
+	glist.add_edges_from(v3, { std::make_pair(17, v4), std::make_pair(18, v2), std::make_pair(19, v1) });
+	REQUIRE(glist.in_edge_size(v2) == 4);
+
+	// Relocation keeps sources pointing to live vertices
+	glist.compact();
+	auto vit = glist.begin();
+	v1 = vit++.get_node();
+	v2 = vit++.get_node();
+	v3 = vit++.get_node();
+	v4 = vit++.get_node();
+	REQUIRE(glist.in_edge_size(v2) == 4);
+
+	glist.remove_vertex(v2);
+	REQUIRE(glist.size() == 3);
+	REQUIRE(glist.edge_size(1) == 0);
+	REQUIRE(glist.edge_size(3) == 2);
+	REQUIRE(glist.in_edge_size(v4) == 1);
+
+	auto eit = glist.edge_begin(v3);
+	REQUIRE(*eit++ == 17);
+	REQUIRE(*eit++ == 19);
+	REQUIRE(eit == glist.edge_end());
+
+	// Removing the tail keeps appends working
+	glist.remove_vertex(v4);
+	REQUIRE(glist.in_edge_size(v1) == 1);
+	auto v5 = glist.add_vertex(5);
+	glist.add_edge(16, 3, 5);
+	REQUIRE(glist.size() == 3);
+	REQUIRE(glist.in_edge_size(v5) == 1);
+
+	auto eit_after = glist.edge_begin(v3);
+	REQUIRE(*eit_after++ == 19);
+	REQUIRE(*eit_after++ == 16);
+	REQUIRE(eit_after == glist.edge_end());
+
+	// Vertices of another graph are rejected
+	graph_list<int, int> other;
+	auto stranger = other.add_vertex(1);
+	REQUIRE_THROWS_AS(glist.remove_vertex(stranger), std::invalid_argument);
+	REQUIRE_THROWS_AS(glist.remove_egde(stranger, v1), std::invalid_argument);
+	REQUIRE(other.size() == 1);
+
+	glist.disable_in_edges();
+	REQUIRE_FALSE(glist.has_in_edges());
+	glist.remove_vertex(v5);
+	REQUIRE(glist.edge_size(3) == 1);
+
+	glist.clear();
+	REQUIRE(glist.empty());
+}
+
+TEST_CASE("Edge arrays", "[Methods][GAL]")
+{
+	graph_list<int, int> glist;
+
+	auto v1 = glist.add_vertex(1);
+	auto v2 = glist.add_vertex(2);
+	auto v3 = glist.add_vertex(3);
+	auto v4 = glist.add_vertex(4);
+
+	glist.add_edge(10, v1, v2);
+	glist.add_edge(11, v1, v3);
+
+	REQUIRE_FALSE(glist.has_edge_arrays());
+	glist.enable_edge_arrays();
+	REQUIRE(glist.has_edge_arrays());
+	REQUIRE_THROWS_AS(glist.enable_in_edges(), std::logic_error);
+
+	// Moved and new edges keep their order
+	glist.add_edge(12, v1, v4);
+	glist.add_edges_from(v1, { std::make_pair(13, v2) });
+	glist.add_edge(20, v2, v3);
+	REQUIRE(glist.edge_size(v1) == 4);
+
+	std::vector<int> weights, targets;
+	for (auto eit = glist.edge_begin(v1); eit != glist.edge_end(); eit++)
+	{
+		REQUIRE(eit.get_node() == nullptr);
+		weights.push_back(*eit);
+		targets.push_back(eit.target()->data);
+	}
+
+	REQUIRE(weights == std::vector<int>({ 10, 11, 12, 13 }));
+	REQUIRE(targets == std::vector<int>({ 2, 3, 4, 2 }));
+	REQUIRE(glist.edge_begin(v4) == glist.edge_end());
+
+	glist.edge_map(v1, [](int& w) { w *= 2; });
+
+	int acc = 0;
+	glist.edge_fold(acc, v1, [](int w) { return w; });
+	REQUIRE(acc == 92);
+
+	acc = 0;
+	glist.edge_fold<int>(acc, 2, [](int w) { return w; });
+	REQUIRE(acc == 20);
+
+	// Algorithms walk the arrays too
+	std::vector<int> order;
+	glist.bfs_vertex_map([&order](int& v) { order.push_back(v); });
+	REQUIRE(order == std::vector<int>({ 1, 2, 3, 4 }));
+	REQUIRE(glist.is_reachable(v2, v3));
+	REQUIRE_FALSE(glist.is_reachable(v4, v1));
+	REQUIRE(glist.topological_sort().size() == 4);
+	REQUIRE(glist.freeze().edge_count() == 5);
+
+	// Removals keep the rest in order
+	glist.remove_egde(v1, v2);
+	glist.remove_vertex(v4);
+	REQUIRE(glist.edge_size(v1) == 2);
+
+	// Reused id comes with empty arrays; new ids don't move the arrays under an iterator
+	auto held = glist.edge_begin(v1);
+	auto v5 = glist.add_vertex(5);
+	REQUIRE(v5->id == 3);
+	REQUIRE(glist.edge_begin(v5) == glist.edge_end());
+
+	for (int v = 6; v < 1000; v++)
+		glist.add_vertex(v);
+
+	REQUIRE(held.target() == v3);
+	REQUIRE(*held == 22);
+
+	// Targets follow relocated vertices
+	glist.compact();
+	auto vit = glist.begin();
+	v1 = vit++.get_node();
+	v2 = vit++.get_node();
+
+	auto eit = glist.edge_begin(v1);
+	REQUIRE(eit.target()->data == 3);
+	REQUIRE(*eit++ == 22);
+	REQUIRE(eit.target() == v2);
+	REQUIRE(*eit++ == 26);
+	REQUIRE(eit == glist.edge_end());
+
+	// Back to chains
+	glist.disable_edge_arrays();
+	REQUIRE_FALSE(glist.has_edge_arrays());
+
+	auto chained = glist.edge_begin(v1);
+	REQUIRE(chained.get_node() != nullptr);
+	REQUIRE(*chained++ == 22);
+	REQUIRE(*chained++ == 26);
+	REQUIRE(chained == glist.edge_end());
+
+	glist.enable_in_edges();
+	REQUIRE(glist.in_edge_size(v2) == 1);
+}
+
+TEST_CASE("Streaming edge-list loader", "[Construction][GAL]")
+{
+	const char* text_path = "hadt_edges_test.txt";
+	const char* bin_path = "hadt_edges_test.bin";
+
+	{
+		std::ofstream out(text_path, std::ios::binary);
+		out << "# src dst weight\n"
+			<< "1 2 10\r\n"
+			<< "\n"
+			<< "  2\t3 -20\n"
+			<< "3 1\n"
+			<< "% comment\n"
+			<< "4 1 40";
+	}
+
+	graph_list<int, int> glist;
+	glist.add_vertex(4);
+
+	REQUIRE(glist.load_edge_list(text_path) == 4);
+	REQUIRE(glist.size() == 4);
+	REQUIRE_FALSE(glist.has_vertex_index());
+	REQUIRE(glist.edge_size(1) == 1);
+	REQUIRE(glist.edge_size(2) == 1);
+	REQUIRE(glist.edge_size(4) == 1);
+
+	int acc = 0;
+	glist.edge_fold<int>(acc, 2, [](int w) { return w; });
+	REQUIRE(acc == -20);
+
+	acc = 0;
+	glist.edge_fold<int>(acc, 3, [](int w) { return w; });
+	REQUIRE(acc == 0);
+
+	// Binary round trip keeps vertex order, edges and weights
+	glist.save_edge_list_binary(bin_path);
+
+	graph_list<int, int> copy;
+	REQUIRE(copy.load_edge_list_binary(bin_path) == 4);
+	REQUIRE(copy.size() == 4);
+
+	auto vit = copy.begin();
+	REQUIRE(*vit++ == 4);
+	REQUIRE(*vit++ == 1);
+	REQUIRE(copy.edge_size(4) == 1);
+
+	acc = 0;
+	copy.edge_fold<int>(acc, 4, [](int w) { return w; });
+	REQUIRE(acc == 40);
+
+	graph_list<int, double> wrong_types;
+	REQUIRE_THROWS_AS(wrong_types.load_edge_list_binary(bin_path), std::runtime_error);
+	REQUIRE_THROWS_AS(wrong_types.load_edge_list_binary(text_path), std::runtime_error);
+
+	// Counts that don't fit in the file are rejected before anything is allocated for them
+	hadt::io::edge_list_header header;
+	std::memcpy(header.magic, hadt::io::edge_list_magic, sizeof(header.magic));
+	header.payload_size = sizeof(int);
+	header.weight_size = sizeof(int);
+
+	header.vertex_count = UINT32_MAX;
+	header.edge_count = 0;
+	{
+		std::ofstream out(bin_path, std::ios::binary);
+		out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+	}
+	graph_list<int, int> corrupt;
+	REQUIRE_THROWS_AS(corrupt.load_edge_list_binary(bin_path), std::runtime_error);
+
+	header.vertex_count = 1;
+	header.edge_count = UINT64_MAX / 2;
+	{
+		std::ofstream out(bin_path, std::ios::binary);
+		out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+		int payload = 7;
+		out.write(reinterpret_cast<const char*>(&payload), sizeof(payload));
+	}
+	REQUIRE_THROWS_AS(corrupt.load_edge_list_binary(bin_path), std::runtime_error);
+	REQUIRE(corrupt.size() == 0);
+
+	{
+		std::ofstream out(text_path, std::ios::binary);
+		out << "1 2 3\n1 x 3\n";
+	}
+
+	REQUIRE_THROWS_AS(copy.load_edge_list(text_path), std::runtime_error);
+	REQUIRE_THROWS_AS(copy.load_edge_list("hadt_no_such_file.txt"), std::runtime_error);
+
+	// Integral fields up to the type's limits load, one past them fails the line
+	{
+		std::ofstream out(text_path, std::ios::binary);
+		out << "1 2 2147483647\n2 1 -2147483648\n";
+	}
+
+	graph_list<int, int> limits;
+	REQUIRE(limits.load_edge_list(text_path) == 2);
+
+	acc = 0;
+	limits.edge_fold<int>(acc, 1, [](int w) { return w; });
+	REQUIRE(acc == 2147483647);
+	acc = 0;
+	limits.edge_fold<int>(acc, 2, [](int w) { return w; });
+	REQUIRE(acc == -2147483647 - 1);
+
+	{
+		std::ofstream out(text_path, std::ios::binary);
+		out << "1 2 2147483648\n";
+	}
+	REQUIRE_THROWS_AS(limits.load_edge_list(text_path), std::runtime_error);
+
+	{
+		std::ofstream out(text_path, std::ios::binary);
+		out << "1 2 -2147483649\n";
+	}
+	REQUIRE_THROWS_AS(limits.load_edge_list(text_path), std::runtime_error);
+
+	// Floating-point tokens longer than the parse buffer aren't cut short
+	{
+		std::ofstream out(text_path, std::ios::binary);
+		out << "1 2 0." << std::string(80, '1') << "\n";
+	}
+
+	graph_list<int, double> real_weights;
+	REQUIRE_THROWS_AS(real_weights.load_edge_list(text_path), std::runtime_error);
+
+	std::remove(text_path);
+	std::remove(bin_path);
+}
+
+TEST_CASE("External visited state", "[Methods][GAL]")
+{
+	graph_list<int, int> glist;
+	glist.add_vertices({ 1, 2, 3, 4, 5 });
+	glist.add_edges({
+		hadt::make_edge(0, 1, 2),
+		hadt::make_edge(0, 1, 3),
+		hadt::make_edge(0, 2, 4),
+		hadt::make_edge(0, 3, 4),
+		hadt::make_edge(0, 4, 1),
+		hadt::make_edge(0, 4, 5)
+	});
+
+	const auto& cglist = glist;
+	hadt::visited_marks marks;
+
+	// Same marks can be reused without any reset pass
+	for (int round = 0; round < 3; round++)
+	{
+		std::vector<int> order;
+		cglist.bfs_vertex_map([&order](const int& v) { order.push_back(v); }, marks);
+		REQUIRE(order == std::vector<int>({ 1, 2, 3, 4, 5 }));
+
+		order.clear();
+		cglist.dfs_vertex_map([&order](const int& v) { order.push_back(v); }, marks);
+		REQUIRE(order == std::vector<int>({ 1, 2, 4, 5, 3 }));
+	}
+
+	// Concurrent read-only traversals, each with its own marks
+	std::vector<int> sums(4, 0);
+	std::vector<std::thread> workers;
+	for (size_t t = 0; t < sums.size(); t++)
+	{
+		workers.emplace_back([&cglist, &sums, t]() {
+			hadt::visited_marks local;
+			for (int i = 0; i < 100; i++)
+				cglist.bfs_vertex_map([&sums, t](const int& v) { sums[t] += v; }, local);
+		});
+	}
+
+	for (auto &w : workers)
+		w.join();
+
+	for (auto s : sums)
+		REQUIRE(s == 1500);
+
+	// Ids of removed vertices are reused
+	REQUIRE(glist.id_bound() == 5);
+	auto vit = glist.begin();
+	vit++;
+	glist.remove_vertex(vit.get_node());
+	glist.add_vertex(6);
+	REQUIRE(glist.id_bound() == 5);
+
+	// Ids are 32-bit, like the positions of graph_csr and binary edge lists
+	REQUIRE(sizeof(glist.begin().get_node()->id) == sizeof(std::uint32_t));
+
+	std::vector<int> order;
+	glist.dfs_vertex_map([&order](int& v) { order.push_back(v); });
+	REQUIRE(order == std::vector<int>({ 1, 3, 4, 5 }));
+}
+
+TEST_CASE("Parallel direction-optimizing BFS", "[Methods][GAL]")
+{
+	typedef hadt::graph_csr<int, int> csr_type;
+	typedef csr_type::index_type index_type;
+
+	// Sparse pseudo-random graph, big enough to use several threads in both directions
+	const size_t n = 200000;
+	std::vector<int> vertices(n);
+	std::vector<size_t> offsets(1, 0);
+	std::vector<index_type> targets;
+	std::vector<int> weights;
+
+	for (size_t v = 0; v < n; v++)
+	{
+		vertices[v] = static_cast<int>(v);
+
+		// Last tenth of vertices is unreachable
+		if (v < n - n / 10)
+		{
+			targets.push_back(static_cast<index_type>((v * 7 + 1) % (n - n / 10)));
+			targets.push_back(static_cast<index_type>((v * 13 + 5) % (n - n / 10)));
+			targets.push_back(static_cast<index_type>((v * 31 + 2) % (n - n / 10)));
+		}
+
+		weights.resize(targets.size(), 1);
+		offsets.push_back(targets.size());
+	}
+
+	csr_type csr(std::move(vertices), std::move(offsets), std::move(targets), std::move(weights));
+
+	// Reference levels
+	std::vector<index_type> expected(n, csr_type::npos);
+	std::deque<index_type> queue(1, 0);
+	expected[0] = 0;
+	while (!queue.empty())
+	{
+		auto u = queue.front();
+		queue.pop_front();
+
+		for (size_t e = csr.offsets()[u]; e < csr.offsets()[u + 1]; e++)
+		{
+			auto v = csr.targets()[e];
+			if (expected[v] == csr_type::npos)
+			{
+				expected[v] = expected[u] + 1;
+				queue.push_back(v);
+			}
+		}
+	}
+
+	auto check = [&](const csr_type::bfs_tree& tree) {
+		REQUIRE(tree.levels == expected);
+		REQUIRE(tree.order.size() == n - n / 10);
+		REQUIRE(tree.order.front() == 0);
+		REQUIRE(tree.parents[0] == 0);
+		REQUIRE(tree.parents[n - 1] == csr_type::npos);
+
+		bool consistent = true;
+		for (size_t i = 1; i < tree.order.size(); i++)
+		{
+			auto v = tree.order[i];
+			consistent = consistent && tree.levels[tree.order[i - 1]] <= tree.levels[v];
+			consistent = consistent && tree.levels[tree.parents[v]] + 1 == tree.levels[v];
+		}
+
+		REQUIRE(consistent);
+	};
+
+	// Top-down only
+	check(csr.parallel_bfs(0, 4));
+
+	// Direction switching
+	csr.build_reverse();
+	REQUIRE(csr.has_reverse());
+	check(csr.parallel_bfs(0, 4));
+	check(csr.parallel_bfs(0, 1));
+
+	REQUIRE_THROWS_AS(csr.parallel_bfs(static_cast<index_type>(n)), std::out_of_range);
+}
+
+
+TEST_CASE("Weighted shortest paths", "[Methods][GAL]")
+{
+	typedef hadt::graph_csr<char, int> csr_type;
+
+	graph_list<char, int> glist;
+	glist.add_vertices({ 'A', 'B', 'C', 'D', 'E', 'F' });
+	glist.add_edges({
+		hadt::make_edge(7, 'A', 'B'),
+		hadt::make_edge(9, 'A', 'C'),
+		hadt::make_edge(14, 'A', 'F'),
+		hadt::make_edge(10, 'B', 'C'),
+		hadt::make_edge(15, 'B', 'D'),
+		hadt::make_edge(11, 'C', 'D'),
+		hadt::make_edge(2, 'C', 'F'),
+		hadt::make_edge(6, 'D', 'E'),
+		hadt::make_edge(9, 'F', 'E')
+	});
+
+	auto csr = glist.freeze();
+
+	auto tree = csr.dijkstra(0);
+	REQUIRE(tree.distances == std::vector<int>({ 0, 7, 9, 20, 20, 11 }));
+	REQUIRE(tree.parents[4] == 5);
+	REQUIRE(tree.parents[0] == 0);
+
+	// Both algorithms agree on non-negative weights
+	auto bf = csr.bellman_ford(0);
+	REQUIRE(bf.distances == tree.distances);
+
+	std::vector<csr_type::index_type> path;
+	REQUIRE(csr.shortest_path(0, 4, path) == 20);
+	REQUIRE(path == std::vector<csr_type::index_type>({ 0, 2, 5, 4 }));
+
+	// Nothing leads back to 'A'
+	REQUIRE(csr.shortest_path(4, 0, path) == csr_type::unreachable());
+	REQUIRE(path.empty());
+	REQUIRE(csr.dijkstra(3).parents[1] == csr_type::npos);
+	REQUIRE_THROWS_AS(csr.dijkstra(6), std::out_of_range);
+
+	// Negative weights go to Bellman-Ford
+	graph_list<char, int> negative;
+	negative.add_vertices({ 'A', 'B', 'C', 'D' });
+	negative.add_edges({
+		hadt::make_edge(4, 'A', 'B'),
+		hadt::make_edge(5, 'A', 'C'),
+		hadt::make_edge(-3, 'C', 'B'),
+		hadt::make_edge(2, 'B', 'D')
+	});
+
+	auto neg_csr = negative.freeze();
+	REQUIRE(neg_csr.shortest_paths(0).distances == std::vector<int>({ 0, 2, 5, 4 }));
+
+	negative.add_edge(-4, 'D', 'C');
+	REQUIRE_THROWS_AS(negative.freeze().shortest_paths(0), std::domain_error);
+
+	// Heap on its own
+	hadt::dary_heap<int> heap(8);
+	heap.push_or_decrease(3, 30);
+	heap.push_or_decrease(5, 10);
+	heap.push_or_decrease(1, 20);
+	REQUIRE_FALSE(heap.push_or_decrease(5, 15));
+	REQUIRE(heap.push_or_decrease(3, 5));
+	REQUIRE(heap.top_priority() == 5);
+	REQUIRE(heap.pop() == 3);
+	REQUIRE(heap.pop() == 5);
+	REQUIRE(heap.pop() == 1);
+	REQUIRE(heap.empty());
+	REQUIRE_THROWS_AS(heap.pop(), std::length_error);
+	REQUIRE_THROWS_AS(heap.push_or_decrease(8, 1), std::out_of_range);
+}
+
+
+TEST_CASE("Path fold with custom operators", "[Methods][GAL]")
+{
+	graph_list<int, int> glist;
+
+	auto n1 = glist.add_vertex(1);
+	auto n2 = glist.add_vertex(2);
+	auto n3 = glist.add_vertex(3);
+	auto n4 = glist.add_vertex(4);
+	auto n5 = glist.add_vertex(5);
+
+	glist.add_edge(0, n1, n2);
+	glist.add_edge(0, n1, n3);
+	glist.add_edge(0, n2, n4);
+	glist.add_edge(0, n2, n5);
+	glist.add_edge(0, n3, n4);
+
+	// Back edge is skipped
+	glist.add_edge(0, n4, n1);
+	glist.add_edge(0, n4, n5);
+
+	std::vector<int> legacy;
+	glist.dfs_path_fold<std::vector<int>, std::plus<int>>(legacy, [](int v) { return v; });
+
+	std::vector<int> sums;
+	glist.dfs_path_fold_with(sums, [](int v) { return v; }, std::plus<int>());
+	REQUIRE(sums == legacy);
+	REQUIRE(sums == std::vector<int>({ 12, 8, 13 }));
+
+	// Stateful operator: paths as digit strings, counting fold calls
+	size_t calls = 0;
+	std::vector<std::string> paths;
+	hadt::visited_marks marks;
+
+	const auto& cglist = glist;
+	cglist.dfs_path_fold_with(paths,
+		[](int v) { return std::to_string(v); },
+		[&calls](const std::string& acc, const std::string& v) { calls++; return acc + v; },
+		marks);
+
+	REQUIRE(paths == std::vector<std::string>({ "1245", "125", "1345" }));
+
+	// One fold per pushed vertex (1 -> 2 -> 4 -> 5, 5, 3 -> 4 -> 1 (dead end), 5), not per path element
+	REQUIRE(calls == 9);
+}
+
+// Path fold as done before frames kept edge cursors: every step rescans the top vertex's edges
+static auto rescan_path_fold(graph_list<int, int>& glist) -> std::vector<std::string>
+{
+	typedef hadt::VertexNode<int, int>* VNode;
+
+	std::vector<std::string> paths;
+	hadt::visited_marks marks;
+	marks.reset(glist.size());
+
+	std::vector<VNode> v_list(1, glist.begin().get_node());
+	while (!v_list.empty())
+	{
+		auto temp = v_list.back();
+		marks.mark(temp->id);
+
+		if (glist.edge_size(temp) == 0)
+		{
+			std::string path;
+			for (auto node : v_list)
+				path += std::to_string(node->data);
+
+			paths.push_back(path);
+			v_list.pop_back();
+			continue;
+		}
+
+		bool all_visited = true;
+		for (auto it = glist.edge_begin(temp); it != glist.edge_end(); it++)
+		{
+			if (!marks.is_marked(it.target()->id))
+			{
+				v_list.push_back(it.target());
+				all_visited = false;
+				break;
+			}
+		}
+
+		if (all_visited)
+		{
+			for (auto it = glist.edge_begin(temp); it != glist.edge_end(); it++)
+				marks.unmark(it.target()->id);
+
+			v_list.pop_back();
+		}
+	}
+
+	return paths;
+}
+
+TEST_CASE("Path fold over diamonds", "[Methods][GAL]")
+{
+	auto to_string = [](int v) { return std::to_string(v); };
+
+	// 1 -> {2, 3} -> 4: both paths reach 4
+	graph_list<int, int> diamond;
+	diamond.add_vertices({ 1, 2, 3, 4 });
+	diamond.add_edges({
+		hadt::make_edge(0, 1, 2),
+		hadt::make_edge(0, 1, 3),
+		hadt::make_edge(0, 2, 4),
+		hadt::make_edge(0, 3, 4)
+	});
+
+	std::vector<std::string> paths;
+	diamond.dfs_path_fold_with(paths, to_string, std::plus<std::string>());
+	REQUIRE(paths == std::vector<std::string>({ "124", "134" }));
+	REQUIRE(paths == rescan_path_fold(diamond));
+
+	// Two diamonds in a row, the second one wider: 1 -> {2, 3} -> 4 -> {5, 6, 7} -> 8
+	graph_list<int, int> chain;
+	chain.add_vertices({ 1, 2, 3, 4, 5, 6, 7, 8 });
+	chain.add_edges({
+		hadt::make_edge(0, 1, 2),
+		hadt::make_edge(0, 1, 3),
+		hadt::make_edge(0, 2, 4),
+		hadt::make_edge(0, 3, 4),
+		hadt::make_edge(0, 4, 5),
+		hadt::make_edge(0, 4, 6),
+		hadt::make_edge(0, 4, 7),
+		hadt::make_edge(0, 5, 8),
+		hadt::make_edge(0, 6, 8),
+		hadt::make_edge(0, 7, 8)
+	});
+
+	paths.clear();
+	chain.dfs_path_fold_with(paths, to_string, std::plus<std::string>());
+	REQUIRE(paths == std::vector<std::string>({ "12458", "12468", "12478", "13458", "13468", "13478" }));
+	REQUIRE(paths == rescan_path_fold(chain));
+
+	// Same through the Oper-based overload
+	std::vector<int> sums;
+	chain.dfs_path_fold<std::vector<int>, std::plus<int>>(sums, [](int v) { return v; });
+	REQUIRE(sums == std::vector<int>({ 20, 21, 22, 21, 22, 23 }));
+
+	// A later branch leading back to an earlier sibling: the rescan found "12" again after 3
+	// unmarked 2, a cursor doesn't go back over it
+	graph_list<int, int> sibling;
+	sibling.add_vertices({ 1, 2, 3 });
+	sibling.add_edges({
+		hadt::make_edge(0, 1, 2),
+		hadt::make_edge(0, 1, 3),
+		hadt::make_edge(0, 3, 2)
+	});
+
+	paths.clear();
+	sibling.dfs_path_fold_with(paths, to_string, std::plus<std::string>());
+	REQUIRE(paths == std::vector<std::string>({ "12" }));
+	REQUIRE(rescan_path_fold(sibling) == std::vector<std::string>({ "12", "12" }));
+}
+
+
+TEST_CASE("Arena-backed graph storage", "[Methods][Construction][GAL]")
+{
+	graph_list<std::string, int> glist;
+
+	glist.enable_arena(1024);
+	REQUIRE(glist.has_arena());
+
+	auto a = glist.add_vertex("A");
+	auto b = glist.add_vertex("B");
+	auto c = glist.add_vertex("C");
+	glist.add_edge(1, a, b);
+
+	REQUIRE_THROWS_AS(glist.disable_arena(), std::logic_error);
+
+	// Batch lands in one contiguous run
+	std::vector<std::pair<int, hadt::VertexNode<std::string, int>*>> batch;
+	for (int i = 0; i < 40; i++)
+		batch.push_back(std::make_pair(i, i % 2 ? b : c));
+
+	glist.add_edges_from(a, batch.begin(), batch.end());
+	REQUIRE(glist.edge_size(a) == 41);
+
+	auto eit = glist.edge_begin(a);
+	eit++;
+	auto first = eit.get_node();
+	bool adjacent = true;
+	for (int i = 1; i < 40; i++)
+	{
+		auto prev = eit.get_node();
+		eit++;
+		adjacent = adjacent && reinterpret_cast<const char*>(eit.get_node()) > reinterpret_cast<const char*>(prev);
+	}
+
+	REQUIRE(adjacent);
+	REQUIRE(reinterpret_cast<const char*>(eit.get_node()) - reinterpret_cast<const char*>(first) < 40 * 64);
+
+	// Removal only destroys nodes
+	glist.remove_vertex(c);
+	REQUIRE(glist.edge_size(a) == 21);
+
+	for (int i = 0; i < 100; i++)
+		glist.add_vertex(std::to_string(i));
+	REQUIRE(glist.size() == 102);
+
+	std::vector<std::string> order;
+	glist.bfs_vertex_map([&order](std::string& v) { order.push_back(v); });
+	REQUIRE(order == std::vector<std::string>({ "A", "B" }));
+
+	// Compacting moves everything out of the arena
+	glist.compact();
+	REQUIRE(glist.edge_size("A") == 21);
+
+	glist.clear();
+	REQUIRE(glist.empty());
+
+	// Arena is reused after clear()
+	glist.add_vertices({ "X", "Y" });
+	glist.add_edge(5, "X", "Y");
+	REQUIRE(glist.edge_size("X") == 1);
+
+	glist.clear();
+	glist.disable_arena();
+	REQUIRE_FALSE(glist.has_arena());
+
+	// Nodes without destructors: clear() only gives back the blocks
+	REQUIRE(std::is_trivially_destructible<hadt::VertexNode<int, int>>::value);
+	REQUIRE(std::is_trivially_destructible<hadt::EdgeNode<int, int>>::value);
+
+	graph_list<int, int> plain;
+	plain.enable_arena(1024);
+	plain.enable_in_edges();
+
+	std::vector<hadt::VertexNode<int, int>*> nodes;
+	for (int v = 0; v < 200; v++)
+		nodes.push_back(plain.add_vertex(v));
+	for (size_t v = 1; v < nodes.size(); v++)
+		plain.add_edge(static_cast<int>(v), nodes[v - 1], nodes[v]);
+	REQUIRE(plain.in_edge_size(nodes[1]) == 1);
+
+	plain.clear();
+	REQUIRE(plain.empty());
+
+	// Ids and in-edge lists start over
+	auto x = plain.add_vertex(1);
+	auto y = plain.add_vertex(2);
+	plain.add_edge(7, x, y);
+	REQUIRE(x->id == 0);
+	REQUIRE(plain.in_edge_size(x) == 0);
+	REQUIRE(plain.in_edge_size(y) == 1);
+}
+
+
+namespace {
+
+	// Non-copyable visitor: can't be wrapped into std::function
+	struct counting_visitor
+	{
+		int count;
+		int sum;
+
+		counting_visitor() : count{ 0 }, sum{ 0 } {};
+		counting_visitor(const counting_visitor&) = delete;
+		counting_visitor& operator=(const counting_visitor&) = delete;
+
+		void operator()(const int& v) { count++; sum += v; }
+	};
+
+}
+
+TEST_CASE("Callable template overloads", "[Methods][GAL]")
+{
+	graph_list<int, int> glist;
+	glist.add_vertices({ 1, 2, 3, 4 });
+	glist.add_edges({
+		hadt::make_edge(10, 1, 2),
+		hadt::make_edge(20, 1, 3),
+		hadt::make_edge(30, 3, 4)
+	});
+
+	counting_visitor visitor;
+	glist.bfs_vertex_map(visitor);
+	REQUIRE(visitor.count == 4);
+	REQUIRE(visitor.sum == 10);
+
+	glist.dfs_vertex_map(visitor);
+	REQUIRE(visitor.count == 8);
+
+	const auto& cglist = glist;
+	hadt::visited_marks marks;
+	cglist.bfs_vertex_map(visitor, marks);
+	cglist.dfs_vertex_map(visitor, marks);
+	REQUIRE(visitor.count == 16);
+
+	glist.vertex_map([](int& v) { v *= 2; });
+
+	int acc = 0;
+	glist.vertex_fold(acc, [](const int& v) { return v; });
+	REQUIRE(acc == 20);
+
+	glist.edge_map(2, [](int& w) { w += 1; });
+	glist.edge_map(6, [](int& w) { w += 1; });
+
+	int w_acc = 0;
+	glist.edge_fold(w_acc, 2, [](int w) { return w; });
+	REQUIRE(w_acc == 32);
+
+	w_acc = 0;
+	glist.edge_fold(w_acc, glist.begin().get_node(), [](const int& w) { return w; });
+	REQUIRE(w_acc == 32);
+
+	REQUIRE_THROWS_AS(glist.edge_fold(w_acc, 42, [](int w) { return w; }), std::invalid_argument);
+	REQUIRE_THROWS_AS(glist.edge_map(static_cast<hadt::VertexNode<int, int>*>(nullptr), [](int&) {}), std::invalid_argument);
+}
+
+
+TEST_CASE("Lazy BFS/DFS ranges", "[Methods][GAL]")
+{
+	graph_list<int, int> glist;
+	glist.add_vertices({ 1, 2, 3, 4, 5, 6 });
+	glist.add_edges({
+		hadt::make_edge(0, 1, 2),
+		hadt::make_edge(0, 1, 3),
+		hadt::make_edge(0, 2, 4),
+		hadt::make_edge(0, 3, 4),
+		hadt::make_edge(0, 4, 1),
+		hadt::make_edge(0, 4, 5),
+		hadt::make_edge(0, 6, 1)
+	});
+
+	// Same order as the callback traversals
+	std::vector<int> expected, order;
+	glist.bfs_vertex_map([&expected](int& v) { expected.push_back(v); });
+	for (auto &v : glist.bfs_range())
+		order.push_back(v);
+	REQUIRE(order == expected);
+
+	expected.clear();
+	order.clear();
+	glist.dfs_vertex_map([&expected](int& v) { expected.push_back(v); });
+	for (auto &v : glist.dfs_range())
+		order.push_back(v);
+	REQUIRE(order == expected);
+
+	// Any start vertex; 6 is reachable from nowhere else
+	order.clear();
+	const auto& cglist = glist;
+	for (auto &v : cglist.bfs_range(6))
+		order.push_back(v);
+	REQUIRE(order == std::vector<int>({ 6, 1, 2, 3, 4, 5 }));
+
+	// Early termination
+	order.clear();
+	for (auto &v : glist.dfs_range(3))
+	{
+		order.push_back(v);
+		if (v == 4)
+			break;
+	}
+	REQUIRE(order == std::vector<int>({ 3, 4 }));
+
+	// Mutable access
+	auto range = glist.bfs_range(glist.begin().get_node());
+	auto it = range.begin();
+	*it = 10;
+	++it;
+	REQUIRE(it.get_node()->data == 2);
+	REQUIRE(glist.begin().get_node()->data == 10);
+
+	REQUIRE_THROWS_AS(glist.bfs_range(42), std::invalid_argument);
+
+	graph_list<int, int> empty;
+	REQUIRE(empty.dfs_range().begin() == empty.dfs_range().end());
+}
+
+
+TEST_CASE("Topological order and cycles", "[Methods][GAL]")
+{
+	// 1 -> 2 -> 4 -> 5, 1 -> 3 -> 5, 6 -> 3
+	graph_list<int, int> glist;
+	glist.add_vertices({ 1, 2, 3, 4, 5, 6 });
+	glist.add_edges({
+		hadt::make_edge(0, 1, 2),
+		hadt::make_edge(0, 1, 3),
+		hadt::make_edge(0, 2, 4),
+		hadt::make_edge(0, 4, 5),
+		hadt::make_edge(0, 3, 5),
+		hadt::make_edge(0, 6, 3)
+	});
+
+	REQUIRE(glist.is_acyclic());
+	REQUIRE(glist.find_cycle().empty());
+
+	std::vector<int> order;
+	for (auto node : glist.topological_sort())
+		order.push_back(node->data);
+	REQUIRE(order == std::vector<int>({ 1, 6, 2, 3, 4, 5 }));
+
+	// Levels follow the longest path: 5 waits for 4 even though 3 -> 5 is shorter
+	std::vector<std::vector<int>> levels;
+	for (auto& level : glist.topological_levels())
+	{
+		levels.emplace_back();
+		for (auto node : level)
+			levels.back().push_back(node->data);
+	}
+	REQUIRE(levels == std::vector<std::vector<int>>({ { 1, 6 }, { 2, 3 }, { 4 }, { 5 } }));
+
+	// 5 -> 2 closes 2 -> 4 -> 5
+	glist.add_edge(0, 5, 2);
+	REQUIRE_FALSE(glist.is_acyclic());
+	REQUIRE_THROWS_AS(glist.topological_sort(), std::logic_error);
+	REQUIRE_THROWS_AS(glist.topological_levels(), std::logic_error);
+
+	order.clear();
+	for (auto node : glist.find_cycle())
+		order.push_back(node->data);
+	REQUIRE(order == std::vector<int>({ 2, 4, 5 }));
+
+	// Self-loop
+	graph_list<int, int> loop;
+	loop.add_edge(0, loop.add_vertex(7), loop.add_vertex(8));
+	loop.add_edge(0, 8, 8);
+	REQUIRE(loop.find_cycle().size() == 1);
+	REQUIRE(loop.find_cycle()[0]->data == 8);
+
+	graph_list<int, int> empty;
+	REQUIRE(empty.topological_sort().empty());
+	REQUIRE(empty.topological_levels().empty());
+}
+
+
+TEST_CASE("Strongly connected components and reachability", "[Methods][GAL]")
+{
+	// {1, 2} -> {3, 4, 5}, 6 -> {1, 2}, 7 is alone
+	graph_list<int, int> glist;
+	glist.add_vertices({ 1, 2, 3, 4, 5, 6, 7 });
+	glist.add_edges({
+		hadt::make_edge(0, 1, 2),
+		hadt::make_edge(0, 2, 1),
+		hadt::make_edge(0, 2, 3),
+		hadt::make_edge(0, 3, 4),
+		hadt::make_edge(0, 4, 5),
+		hadt::make_edge(0, 5, 3),
+		hadt::make_edge(0, 6, 1)
+	});
+
+	std::vector<std::vector<int>> components;
+	for (auto& component : glist.strongly_connected_components())
+	{
+		components.emplace_back();
+		for (auto node : component)
+			components.back().push_back(node->data);
+	}
+	REQUIRE(components == std::vector<std::vector<int>>({ { 3, 4, 5 }, { 1, 2 }, { 6 }, { 7 } }));
+
+	REQUIRE(glist.is_reachable(6, 5));
+	REQUIRE(glist.is_reachable(4, 3));
+	REQUIRE_FALSE(glist.is_reachable(5, 1));
+	REQUIRE_FALSE(glist.is_reachable(1, 7));
+	REQUIRE_THROWS_AS(glist.is_reachable(1, 42), std::invalid_argument);
+
+	auto index = glist.reachability();
+	REQUIRE(index.has_closure());
+	REQUIRE(index.component_count() == 4);
+	REQUIRE(index.component_of(glist.begin().get_node()->id) == 1);
+	REQUIRE_THROWS_AS(index.component_of(glist.id_bound()), std::out_of_range);
+
+	// Both index flavours agree with the plain search on a bigger pseudo-random graph
+	graph_list<int, int> big;
+	std::vector<hadt::VertexNode<int, int>*> nodes;
+	for (int v = 0; v < 150; v++)
+		nodes.push_back(big.add_vertex(v));
+	for (size_t v = 0; v < nodes.size(); v++)
+	{
+		big.add_edge(0, nodes[v], nodes[(v * 7 + 3) % nodes.size()]);
+		if (v % 3 == 0)
+			big.add_edge(0, nodes[v], nodes[(v * v + 11) % nodes.size()]);
+	}
+
+	auto closure = big.reachability();
+	auto search = big.reachability(0);
+	REQUIRE(closure.has_closure());
+	REQUIRE_FALSE(search.has_closure());
+	REQUIRE(closure.component_count() == big.strongly_connected_components().size());
+
+	bool consistent{ true };
+	for (auto from : nodes)
+		for (auto to : nodes)
+		{
+			auto expected = big.is_reachable(from, to);
+			consistent = consistent && closure.reachable(from, to) == expected && search.reachable(from, to) == expected;
+		}
+	REQUIRE(consistent);
+
+	// Above the default closure limit: labels and pruned search against the plain search
+	graph_list<int, int> huge;
+	nodes.clear();
+	for (int v = 0; v < 9000; v++)
+		nodes.push_back(huge.add_vertex(v));
+	for (size_t v = 0; v < nodes.size(); v++)
+	{
+		// Mostly forward edges, so that components stay small
+		if (v % 5 != 4 && v + 1 < nodes.size())
+			huge.add_edge(0, nodes[v], nodes[v + 1]);
+		if ((v * v + 11) % nodes.size() > v)
+			huge.add_edge(0, nodes[v], nodes[(v * v + 11) % nodes.size()]);
+
+		// Some short cycles
+		if (v % 97 == 0 && v + 3 < nodes.size())
+			huge.add_edge(0, nodes[v + 3], nodes[v]);
+	}
+
+	auto labels = huge.reachability();
+	REQUIRE_FALSE(labels.has_closure());
+	size_t closure_limit = hadt::reachability_index::default_closure_limit;
+	REQUIRE(labels.component_count() > closure_limit);
+
+	auto full = huge.reachability(nodes.size());
+	REQUIRE(full.has_closure());
+
+	hadt::visited_marks marks;
+	std::uint32_t seed = 12345;
+	size_t reached{};
+	consistent = true;
+	for (int query = 0; query < 2000; query++)
+	{
+		seed = seed * 1664525u + 1013904223u;
+		auto from = nodes[(seed >> 8) % nodes.size()];
+		seed = seed * 1664525u + 1013904223u;
+		auto to = nodes[(seed >> 8) % nodes.size()];
+
+		auto expected = huge.is_reachable(from, to);
+		reached += expected ? 1 : 0;
+		consistent = consistent && labels.reachable(from->id, to->id, marks) == expected && full.reachable(from, to) == expected;
+	}
+	REQUIRE(consistent);
+	REQUIRE(reached > 0);
+	REQUIRE(reached < 2000);
+}
+
+
+TEST_CASE("Minimum spanning forest", "[Methods][GAL]")
+{
+	// Two trees: 1..5 and 6-7; direction of edges doesn't matter
+	graph_list<int, int> glist;
+	glist.add_vertices({ 1, 2, 3, 4, 5, 6, 7 });
+	glist.add_edges({
+		hadt::make_edge(4, 1, 2),
+		hadt::make_edge(1, 1, 3),
+		hadt::make_edge(2, 3, 2),
+		hadt::make_edge(5, 2, 4),
+		hadt::make_edge(8, 3, 4),
+		hadt::make_edge(3, 5, 4),
+		hadt::make_edge(0, 5, 5),
+		hadt::make_edge(9, 7, 6)
+	});
+
+	typedef std::tuple<int, int, int> value_edge;
+	auto values = [](const std::vector<graph_list<int, int>::weighted_edge_type>& forest) {
+		std::vector<value_edge> result;
+		for (auto& edge : forest)
+			result.emplace_back(std::get<0>(edge), std::get<1>(edge)->data, std::get<2>(edge)->data);
+		return result;
+	};
+
+	REQUIRE(values(glist.kruskal_msf()) == std::vector<value_edge>({
+		value_edge(1, 1, 3), value_edge(2, 3, 2), value_edge(3, 5, 4), value_edge(5, 2, 4), value_edge(9, 7, 6) }));
+	REQUIRE(values(glist.prim_msf()) == std::vector<value_edge>({
+		value_edge(1, 1, 3), value_edge(2, 3, 2), value_edge(5, 2, 4), value_edge(3, 4, 5), value_edge(9, 6, 7) }));
+
+	// Big enough for the concurrent sort; the last hundred vertices form their own tree
+	graph_list<int, int> big;
+	std::vector<hadt::VertexNode<int, int>*> nodes;
+	const size_t n = 20000;
+	for (size_t v = 0; v < n; v++)
+		nodes.push_back(big.add_vertex(static_cast<int>(v)));
+	for (size_t v = 0; v < n; v++)
+	{
+		size_t first = v < n - 100 ? 0 : n - 100, span = v < n - 100 ? n - 100 : 100;
+		for (size_t k = 1; k <= 7; k++)
+			big.add_edge(static_cast<int>((v * 31 + k * 17) % 1000), nodes[v], nodes[first + (v * k + k * k) % span]);
+	}
+
+	auto total = [](const std::vector<graph_list<int, int>::weighted_edge_type>& forest) {
+		long long sum{};
+		for (auto& edge : forest)
+			sum += std::get<0>(edge);
+		return sum;
+	};
+
+	auto sequential = big.kruskal_msf(1);
+	auto concurrent = big.kruskal_msf(4);
+	auto prim = big.prim_msf();
+
+	REQUIRE(sequential.size() == prim.size());
+	REQUIRE(concurrent.size() == prim.size());
+	REQUIRE(total(sequential) == total(prim));
+	REQUIRE(total(concurrent) == total(prim));
+
+	graph_list<int, int> empty;
+	REQUIRE(empty.kruskal_msf().empty());
+	REQUIRE(empty.prim_msf().empty());
+}
+
+
+TEST_CASE("Vertex property columns", "[Methods][GAL]")
+{
+	graph_list<int, int> glist;
+	auto one = glist.add_vertex(1);
+	auto two = glist.add_vertex(2);
+
+	// Existing and future vertices start with the initial value
+	auto& rank = glist.add_vertex_property<double>(0.5);
+	auto& label = glist.add_vertex_property<std::string>();
+	auto three = glist.add_vertex(3);
+
+	REQUIRE(glist.vertex_property_count() == 2);
+	REQUIRE(rank.size() >= glist.id_bound());
+	REQUIRE(rank[one] == 0.5);
+	REQUIRE(rank[three] == 0.5);
+	REQUIRE(label[three->id].empty());
+
+	rank[two] = 2.0;
+	label[two] = "two";
+	REQUIRE(rank.data()[two->id] == 2.0);
+	REQUIRE(label.at(two->id) == "two");
+	REQUIRE_THROWS_AS(label.at(glist.id_bound() + 10), std::out_of_range);
+
+	// A recycled id gets a fresh slot
+	auto old_id = two->id;
+	glist.remove_vertex(two);
+	auto four = glist.add_vertex(4);
+	REQUIRE(four->id == old_id);
+	REQUIRE(rank[four] == 0.5);
+	REQUIRE(label[four].empty());
+
+	// Indexing by id works for any algorithm state
+	rank.fill(0.0);
+	glist.vertex_map([](int& v) { v *= 10; });
+	for (auto vit = glist.begin(); vit != glist.end(); vit++)
+		rank[vit.get_node()] += *vit;
+	REQUIRE(rank[one] == 10.0);
+	REQUIRE(rank[four] == 40.0);
+
+	glist.remove_vertex_property(label);
+	REQUIRE(glist.vertex_property_count() == 1);
+
+	hadt::vertex_property<int> foreign(1, 0);
+	REQUIRE_THROWS_AS(glist.remove_vertex_property(foreign), std::invalid_argument);
+
+	// Columns survive clear(): ids start over and their slots are reset
+	glist.clear();
+	auto five = glist.add_vertex(5);
+	REQUIRE(five->id == 0);
+	REQUIRE(rank[five] == 0.5);
+}
+
+
+TEST_CASE("CSR weight arrays", "[Methods][GAL]")
+{
+	graph_list<int, int> glist;
+	glist.add_vertices({ 1, 2, 3 });
+	glist.add_edges({
+		hadt::make_edge(4, 1, 2),
+		hadt::make_edge(5, 1, 3),
+		hadt::make_edge(6, 1, 1),
+		hadt::make_edge(7, 3, 2)
+	});
+
+	auto csr = glist.freeze();
+
+	// Weights and targets of a vertex are parallel contiguous runs
+	auto weights = csr.edge_weights(0);
+	auto targets = csr.edge_targets(0);
+	REQUIRE(weights.second - weights.first == 3);
+	REQUIRE(std::vector<int>(weights.first, weights.second) == std::vector<int>({ 4, 5, 6 }));
+	REQUIRE(std::vector<hadt::graph_csr<int, int>::index_type>(targets.first, targets.second) ==
+		std::vector<hadt::graph_csr<int, int>::index_type>({ 1, 2, 0 }));
+	REQUIRE(csr.edge_weights(1).first == csr.edge_weights(1).second);
+	REQUIRE_THROWS_AS(csr.edge_weights(3), std::out_of_range);
+
+	int acc = 0;
+	csr.edge_fold(acc, 0, [](int w) { return w * 2; });
+	REQUIRE(acc == 30);
+
+	csr.edge_map(2, [](int& w) { w += 1; });
+	REQUIRE(*csr.edge_weights(2).first == 8);
+
+	csr.weight_map([](int& w) { w -= 1; });
+	acc = 1;
+	csr.weight_fold(acc, [](int w) { return w; });
+	REQUIRE(acc == 1 + 3 + 4 + 5 + 7);
+
+	// std::function overloads are still picked with an explicit <Res>
+	acc = 0;
+	csr.edge_fold<int>(acc, 0, [](int w) { return w; });
+	REQUIRE(acc == 12);
+}
+
+
+TEST_CASE("Parallel vertex map and fold", "[Methods][GAL]")
+{
+	graph_list<int, int> glist;
+	const int n = 50000;
+	for (int v = 0; v < n; v++)
+		glist.add_vertex(v);
+
+	glist.parallel_vertex_map([](int& v) { v *= 2; }, 4);
+
+	long long expected = 0;
+	for (auto vit = glist.begin(); vit != glist.end(); vit++)
+		expected += *vit;
+	REQUIRE(expected == static_cast<long long>(n) * (n - 1));
+
+	auto sum = glist.parallel_vertex_fold(0LL,
+		[](long long acc, const int& v) { return acc + v; },
+		[](long long a, long long b) { return a + b; }, 4);
+	REQUIRE(sum == expected);
+
+	// Partials are combined in vertex order, so non-commutative operators work too
+	auto first_last = glist.parallel_vertex_fold(std::make_pair(-1, -1),
+		[](std::pair<int, int> acc, const int& v) { return std::make_pair(acc.first < 0 ? v : acc.first, v); },
+		[](std::pair<int, int> a, std::pair<int, int> b) {
+			return b.first < 0 ? a : a.first < 0 ? b : std::make_pair(a.first, b.second);
+		}, 4);
+	REQUIRE(first_last == std::make_pair(0, 2 * (n - 1)));
+
+	auto any_odd = glist.parallel_vertex_fold(false,
+		[](bool acc, const int& v) { return acc || v % 2 != 0; },
+		[](bool a, bool b) { return a || b; });
+	REQUIRE_FALSE(any_odd);
+
+	graph_list<int, int> empty;
+	REQUIRE(empty.parallel_vertex_fold(7, [](int acc, const int& v) { return acc + v; }, [](int a, int b) { return a + b; }) == 7);
+}
+
+
+TEST_CASE("Multi-source BFS", "[Methods][GAL]")
+{
+	typedef hadt::graph_csr<int, int> csr_type;
+	typedef csr_type::index_type index_type;
+
+	// Sparse pseudo-random graph; the last 100 vertices only point into the rest
+	const size_t n = 2000;
+	std::vector<int> vertices(n);
+	std::vector<size_t> offsets(1, 0);
+	std::vector<index_type> targets;
+
+	for (size_t v = 0; v < n; v++)
+	{
+		vertices[v] = static_cast<int>(v);
+		targets.push_back(static_cast<index_type>((v * 7 + 1) % (n - 100)));
+		if (v % 3 == 0)
+			targets.push_back(static_cast<index_type>((v * 13 + 5) % (n - 100)));
+		offsets.push_back(targets.size());
+	}
+
+	std::vector<int> weights(targets.size(), 1);
+	csr_type csr(std::move(vertices), std::move(offsets), std::move(targets), std::move(weights));
+
+	// 150 sources with 128 lanes: a full batch and a partial one; 0 comes twice
+	std::vector<index_type> sources;
+	for (size_t i = 0; i < 150; i++)
+		sources.push_back(static_cast<index_type>(i * 97 % n));
+	sources.push_back(0);
+
+	auto distances = csr.multi_source_bfs(sources, 128);
+	REQUIRE(distances.size() == sources.size());
+
+	bool consistent{ true };
+	for (size_t i = 0; i < sources.size(); i++)
+		consistent = consistent && distances[i] == csr.parallel_bfs(sources[i], 1).levels;
+	REQUIRE(consistent);
+	REQUIRE(distances.back() == distances.front());
+
+	REQUIRE(csr.multi_source_bfs(std::vector<index_type>()).empty());
+	REQUIRE_THROWS_AS(csr.multi_source_bfs(std::vector<index_type>(1, static_cast<index_type>(n))), std::out_of_range);
+}
+
+
+TEST_CASE("PageRank and SpMV", "[Methods][GAL]")
+{
+	// 1 -> 2 (2), 1 -> 3 (3), 2 -> 3 (4), 3 -> 1 (5), 4 is dangling and unreachable
+	graph_list<int, int> glist;
+	glist.add_vertices({ 1, 2, 3, 4 });
+	glist.add_edges({
+		hadt::make_edge(2, 1, 2),
+		hadt::make_edge(3, 1, 3),
+		hadt::make_edge(4, 2, 3),
+		hadt::make_edge(5, 3, 1)
+	});
+
+	auto csr = glist.freeze();
+
+	std::vector<double> x({ 1.0, 10.0, 100.0, 1000.0 }), y;
+	csr.spmv(x, y);
+	REQUIRE(y == std::vector<double>({ 320.0, 400.0, 5.0, 0.0 }));
+	REQUIRE_THROWS_AS(csr.spmv(std::vector<double>(2), y), std::invalid_argument);
+
+	auto pr = csr.pagerank(0.85, 1e-10, 1000);
+	REQUIRE(pr.residual <= 1e-10);
+	REQUIRE(pr.iterations == pr.iteration_seconds.size());
+	REQUIRE(pr.ranks.size() == 4);
+
+	double total{};
+	for (auto r : pr.ranks)
+		total += r;
+	REQUIRE(std::abs(total - 1.0) < 1e-9);
+
+	// 3 collects from both 1 and 2, the unreachable 4 only gets the teleport share
+	REQUIRE(pr.ranks[2] > pr.ranks[0]);
+	REQUIRE(pr.ranks[0] > pr.ranks[1]);
+	REQUIRE(pr.ranks[3] < pr.ranks[1]);
+
+	// Fixed point: r = (1 - d) / n + d * (incoming shares + dangling / n)
+	auto expected_3 = 0.15 / 4 + 0.85 * (pr.ranks[0] / 2 + pr.ranks[1] + pr.ranks[3] / 4);
+	REQUIRE(std::abs(pr.ranks[2] - expected_3) < 1e-8);
+
+	// Iteration cap
+	auto capped = csr.pagerank(0.85, 0.0, 3);
+	REQUIRE(capped.iterations == 3);
+	REQUIRE_THROWS_AS(csr.pagerank(1.5), std::invalid_argument);
+
+	// Same result on several threads and with prebuilt reverse adjacency
+	graph_list<int, int> big;
+	std::vector<hadt::VertexNode<int, int>*> nodes;
+	const size_t n = 5000;
+	for (size_t v = 0; v < n; v++)
+		nodes.push_back(big.add_vertex(static_cast<int>(v)));
+	for (size_t v = 0; v < n; v++)
+		if (v % 10 != 0)
+		{
+			big.add_edge(1, nodes[v], nodes[(v * 7 + 1) % n]);
+			big.add_edge(1, nodes[v], nodes[(v * 13 + 5) % n]);
+		}
+
+	auto big_csr = big.freeze();
+	auto serial = big_csr.pagerank(0.85, 1e-9, 200, 1);
+	big_csr.build_reverse();
+	auto threaded = big_csr.pagerank(0.85, 1e-9, 200, 4);
+
+	double diff{};
+	for (size_t v = 0; v < n; v++)
+		diff += std::abs(serial.ranks[v] - threaded.ranks[v]);
+	REQUIRE(diff < 1e-9);
+
+	std::vector<double> ones(n, 1.0), degrees;
+	big_csr.spmv(ones, degrees, 4);
+	REQUIRE(degrees[0] == 0.0);
+	REQUIRE(degrees[1] == 2.0);
+}